@@ -0,0 +1,414 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/clusterization/measurement_creation_algorithm.hpp"
+#include "traccc/clusterization/spacepoint_formation_algorithm.hpp"
+#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/cluster.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/geometry/geometry.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/reader_edm.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/seed_finding.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/simulation/measurement_smearer.hpp"
+#include "traccc/simulation/simulator.hpp"
+#include "traccc/simulation/smearing_writer.hpp"
+#include "traccc/utils/ranges.hpp"
+
+// Detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/core/detector_metadata.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/frontend/detector_writer.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+
+namespace traccc::benchmarks {
+
+/// Benchmark fixture providing simulated toy detector events
+///
+/// The benchmark argument (@c state.range(0)) is the occupancy of the event,
+/// expressed as the number of generated particles. For every occupancy one
+/// event is simulated with the detray toy detector and turned into detector
+/// cells, so that every host algorithm stage can be fed with the output of
+/// the stage preceding it. The events are produced on first use and are
+/// cached for the lifetime of the benchmark executable.
+///
+class toy_detector_benchmark : public ::benchmark::Fixture {
+
+    public:
+    /// @name Type declarations
+    /// @{
+
+    using detector_type = detray::detector<detray::default_metadata,
+                                           detray::host_container_types>;
+    using b_field_t = covfie::field<detray::bfield::const_bknd_t>;
+    using rk_stepper_type =
+        detray::rk_stepper<b_field_t::view_t, traccc::default_algebra,
+                           detray::constrained_step<>>;
+    using navigator_type = detray::navigator<const detector_type>;
+    using fitter_type = kalman_fitter<rk_stepper_type, navigator_type>;
+    using finding_algorithm_type =
+        traccc::finding_algorithm<rk_stepper_type, navigator_type>;
+    using fitting_algorithm_type = traccc::fitting_algorithm<fitter_type>;
+
+    /// @}
+
+    /// Number of barrel layers of the toy detector
+    static constexpr inline unsigned int n_barrels{4u};
+    /// Number of endcap layers of the toy detector
+    static constexpr inline unsigned int n_endcaps{7u};
+
+    /// Measurement smearing parameters
+    static constexpr std::array<scalar, 2u> smearing{
+        50.f * detray::unit<scalar>::um, 50.f * detray::unit<scalar>::um};
+
+    /// Pitch of the (synthetic) pixels that the measurements are turned into
+    static constexpr scalar pixel_pitch{50.f * detray::unit<scalar>::um};
+    /// Lower corner of the (synthetic) pixel matrix in the local frame
+    static constexpr scalar pixel_min_corner{-100.f * detray::unit<scalar>::mm};
+
+    /// All of the data of a single simulated event
+    ///
+    /// Each member holds the output of one algorithm stage, run on the output
+    /// of the previous one.
+    ///
+    struct event_data {
+        /// Cells of the event, sorted by module
+        cell_collection_types::host cells;
+        /// Modules that the cells belong to
+        cell_module_collection_types::host modules;
+        /// Clusters found by the connected component labelling
+        cluster_container_types::host clusters;
+        /// Measurements created from the clusters
+        measurement_collection_types::host measurements;
+        /// Spacepoints formed from the measurements
+        spacepoint_collection_types::host spacepoints;
+        /// Seeds found from the spacepoints
+        seed_collection_types::host seeds;
+        /// Track parameters estimated from the seeds
+        bound_track_parameters_collection_types::host params;
+        /// Track candidates found by the combinatorial Kalman filter
+        track_candidate_container_types::host track_candidates;
+        /// Fitted tracks
+        track_state_container_types::host track_states;
+    };
+
+    /// The occupancies (number of particles per event) benchmarked
+    static void occupancies(::benchmark::internal::Benchmark* bench) {
+        bench->ArgName("particles")->Arg(100)->Arg(1000)->Arg(5000);
+        bench->Unit(::benchmark::kMillisecond);
+    }
+
+    /// Memory resource used by all of the benchmarks
+    static vecmem::memory_resource& host_mr() {
+        static vecmem::host_memory_resource mr;
+        return mr;
+    }
+
+    /// The (default) configuration of the seed finding
+    static const seedfinder_config& finder_config() {
+        static const seedfinder_config config{};
+        return config;
+    }
+    /// The configuration of the spacepoint grid
+    static const spacepoint_grid_config& grid_config() {
+        static const spacepoint_grid_config config(finder_config());
+        return config;
+    }
+    /// The (default) configuration of the seed filtering
+    static const seedfilter_config& filter_config() {
+        static const seedfilter_config config{};
+        return config;
+    }
+    /// The (default) configuration of the track finding
+    static const finding_algorithm_type::config_type& finding_config() {
+        static const finding_algorithm_type::config_type config{};
+        return config;
+    }
+    /// The (default) configuration of the track fitting
+    static const fitting_algorithm_type::config_type& fitting_config() {
+        static const fitting_algorithm_type::config_type config{};
+        return config;
+    }
+
+    /// The magnetic field vector used in the simulation and reconstruction
+    static const vector3& field_vector() {
+        static const vector3 field{0.f, 0.f, finder_config().bFieldInZ};
+        return field;
+    }
+    /// The magnetic field used in the simulation and reconstruction
+    static const b_field_t& field() {
+        static const b_field_t field =
+            detray::bfield::create_const_field(field_vector());
+        return field;
+    }
+
+    /// Directory holding the files produced by the benchmarks
+    static const std::filesystem::path& output_directory() {
+        static const std::filesystem::path dir =
+            std::filesystem::temp_directory_path() / "traccc_benchmarks";
+        return dir;
+    }
+
+    /// The toy detector, written out and read back in the same way as in the
+    /// reconstruction applications
+    static const detector_type& detector() {
+
+        static const std::unique_ptr<detector_type> det = []() {
+            // Build the toy detector.
+            vecmem::host_memory_resource mr;
+            detray::toy_det_config toy_cfg{};
+            toy_cfg.n_brl_layers(n_barrels)
+                .n_edc_layers(n_endcaps)
+                .do_check(false);
+            const auto [toy_det, name_map] =
+                detray::build_toy_detector(mr, toy_cfg);
+
+            // Write it to disk.
+            std::filesystem::create_directories(output_directory());
+            const auto writer_cfg = detray::io::detector_writer_config{}
+                                        .format(detray::io::format::json)
+                                        .replace_files(true)
+                                        .write_grids(true)
+                                        .write_material(true)
+                                        .path(output_directory().string());
+            detray::io::write_detector(toy_det, name_map, writer_cfg);
+
+            // Read it back.
+            detray::io::detector_reader_config reader_cfg{};
+            reader_cfg
+                .add_file(
+                    (output_directory() / "toy_detector_geometry.json")
+                        .string())
+                .add_file((output_directory() /
+                           "toy_detector_homogeneous_material.json")
+                              .string())
+                .add_file(
+                    (output_directory() / "toy_detector_surface_grids.json")
+                        .string());
+            auto [read_det, read_names] =
+                detray::io::read_detector<detector_type>(host_mr(),
+                                                         reader_cfg);
+            return std::make_unique<detector_type>(std::move(read_det));
+        }();
+        return *det;
+    }
+
+    /// Get the event data for a given occupancy
+    ///
+    /// @param n_particles The number of particles to simulate in the event
+    /// @return The (cached) event data for the requested occupancy
+    ///
+    static const event_data& event(unsigned int n_particles) {
+
+        static std::map<unsigned int, std::unique_ptr<event_data>> events;
+        auto it = events.find(n_particles);
+        if (it == events.end()) {
+            it = events.emplace(n_particles, make_event(n_particles)).first;
+        }
+        return *(it->second);
+    }
+
+    /// Get the event data for the occupancy of a benchmark
+    static const event_data& event(const ::benchmark::State& state) {
+        return event(static_cast<unsigned int>(state.range(0)));
+    }
+
+    private:
+    /// Simulate an event, and run the full chain on it
+    static std::unique_ptr<event_data> make_event(unsigned int n_particles) {
+
+        const detector_type& det = detector();
+
+        // Set up the particle generator.
+        using uniform_gen_t = detray::random_numbers<
+            scalar, std::uniform_real_distribution<scalar>>;
+        using generator_type =
+            detray::random_track_generator<traccc::free_track_parameters,
+                                           uniform_gen_t>;
+        const std::array<scalar, 2u> theta_range =
+            eta_to_theta_range(std::array<scalar, 2u>{-2.5f, 2.5f});
+        generator_type::configuration gen_cfg{};
+        gen_cfg.n_tracks(n_particles);
+        gen_cfg.theta_range(theta_range[0], theta_range[1]);
+        gen_cfg.mom_range(1.f * detray::unit<scalar>::GeV,
+                          10.f * detray::unit<scalar>::GeV);
+        gen_cfg.seed(42);
+        generator_type generator(gen_cfg);
+
+        // Set up the measurement smearing.
+        traccc::measurement_smearer<traccc::default_algebra> meas_smearer(
+            smearing[0], smearing[1]);
+        using writer_type = traccc::smearing_writer<
+            traccc::measurement_smearer<traccc::default_algebra>>;
+        typename writer_type::config smearer_writer_cfg{meas_smearer};
+
+        // Run the simulation.
+        const std::string event_dir =
+            (output_directory() /
+             ("toy_detector_" + std::to_string(n_particles)))
+                .string() +
+            "/";
+        std::filesystem::create_directories(event_dir);
+        auto sim = traccc::simulator<detector_type, b_field_t, generator_type,
+                                     writer_type>(
+            1u, det, field(), std::move(generator),
+            std::move(smearer_writer_cfg), event_dir);
+        sim.run();
+
+        // Read back the simulated measurements.
+        io::measurement_reader_output meas_reader_out(&host_mr());
+        io::read_measurements(meas_reader_out, 0u, event_dir,
+                              data_format::csv);
+
+        // Create the event object.
+        auto result = std::make_unique<event_data>(event_data{
+            cell_collection_types::host{&host_mr()},
+            cell_module_collection_types::host{&host_mr()},
+            cluster_container_types::host{&host_mr()},
+            measurement_collection_types::host{&host_mr()},
+            spacepoint_collection_types::host{&host_mr()},
+            seed_collection_types::host{&host_mr()},
+            bound_track_parameters_collection_types::host{&host_mr()},
+            track_candidate_container_types::host{&host_mr()},
+            track_state_container_types::host{&host_mr()}});
+
+        // Turn the measurements into cells.
+        make_cells(meas_reader_out.measurements, io::alt_read_geometry(det),
+                   result->cells, result->modules);
+
+        // Run the reconstruction chain on the cells.
+        result->clusters = host::sparse_ccl_algorithm{host_mr()}(
+            vecmem::get_data(result->cells));
+        result->measurements = host::measurement_creation_algorithm{host_mr()}(
+            get_data(result->clusters), vecmem::get_data(result->modules));
+        result->spacepoints = host::spacepoint_formation_algorithm{host_mr()}(
+            vecmem::get_data(result->measurements),
+            vecmem::get_data(result->modules));
+        const spacepoint_binning::grids_type grids =
+            spacepoint_binning{finder_config(), grid_config(), host_mr()}
+                .make_grids(result->spacepoints);
+        result->seeds = seed_finding{finder_config(), filter_config()}(
+            result->spacepoints, grids.grid, grids.soa_grid);
+        result->params = track_params_estimation{host_mr()}(
+            result->spacepoints, result->seeds, field_vector());
+        result->track_candidates = finding_algorithm_type{finding_config()}(
+            det, field(), result->measurements, result->params);
+        result->track_states = fitting_algorithm_type{fitting_config()}(
+            det, field(), result->track_candidates);
+
+        return result;
+    }
+
+    /// Turn (smeared) measurements into 2x2 pixel clusters
+    ///
+    /// The activations of the cells are chosen such that the weighted
+    /// centre of each cluster reproduces the position of the measurement.
+    /// Cells shared between clusters have their activations summed up.
+    ///
+    /// @param measurements The measurements to turn into cells
+    /// @param geom The placements of the detector surfaces
+    /// @param[out] cells The cells, sorted by module and channels
+    /// @param[out] modules The modules of the cells, sorted by surface
+    ///
+    static void make_cells(
+        const measurement_collection_types::host& measurements,
+        const geometry& geom, cell_collection_types::host& cells,
+        cell_module_collection_types::host& modules) {
+
+        // Cells per surface, ordered the same way as the CSV reader would
+        // order them.
+        using channels = std::pair<channel_id, channel_id>;
+        std::map<std::uint64_t, std::map<channels, scalar>> cell_map;
+
+        for (const measurement& meas : measurements) {
+
+            auto& surface_cells = cell_map[meas.surface_link.value()];
+
+            // Position of the measurement in units of the pixel pitch,
+            // relative to the centre of the first pixel.
+            const scalar u0 =
+                (meas.local[0] - pixel_min_corner) / pixel_pitch - 0.5f;
+            const scalar u1 =
+                (meas.local[1] - pixel_min_corner) / pixel_pitch - 0.5f;
+            const scalar c0 = std::floor(u0);
+            const scalar c1 = std::floor(u1);
+            const scalar f0 = u0 - c0;
+            const scalar f1 = u1 - c1;
+            const channel_id ch0 = static_cast<channel_id>(c0);
+            const channel_id ch1 = static_cast<channel_id>(c1);
+
+            // Key the cells by (channel1, channel0).
+            surface_cells[{ch1, ch0}] += (1.f - f0) * (1.f - f1);
+            surface_cells[{ch1, ch0 + 1}] += f0 * (1.f - f1);
+            surface_cells[{ch1 + 1, ch0}] += (1.f - f0) * f1;
+            surface_cells[{ch1 + 1, ch0 + 1}] += f0 * f1;
+        }
+
+        // Fill the output collections.
+        for (const auto& [surface, surface_cells] : cell_map) {
+
+            const unsigned int module_link =
+                static_cast<unsigned int>(modules.size());
+            cell_module mod;
+            mod.surface_link = detray::geometry::barcode{surface};
+            mod.placement = geom[surface];
+            mod.pixel.min_corner_x = pixel_min_corner;
+            mod.pixel.min_corner_y = pixel_min_corner;
+            mod.pixel.pitch_x = pixel_pitch;
+            mod.pixel.pitch_y = pixel_pitch;
+            modules.push_back(mod);
+
+            for (const auto& [ch, activation] : surface_cells) {
+                cells.push_back(
+                    {ch.second, ch.first, activation, 0.f, module_link});
+            }
+        }
+    }
+};
+
+}  // namespace traccc::benchmarks
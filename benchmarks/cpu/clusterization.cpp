@@ -0,0 +1,74 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/measurement_creation_algorithm.hpp"
+#include "traccc/clusterization/spacepoint_formation_algorithm.hpp"
+#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
+
+// Benchmark include(s).
+#include "benchmarks/toy_detector_benchmark.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+using namespace traccc;
+using traccc::benchmarks::toy_detector_benchmark;
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, sparse_ccl)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    host::sparse_ccl_algorithm algorithm(host_mr());
+
+    for (auto _ : state) {
+        auto clusters = algorithm(vecmem::get_data(evt.cells));
+        ::benchmark::DoNotOptimize(clusters);
+    }
+    state.counters["cells"] = static_cast<double>(evt.cells.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.cells.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, sparse_ccl)
+    ->Apply(toy_detector_benchmark::occupancies);
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, measurement_creation)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    host::measurement_creation_algorithm algorithm(host_mr());
+
+    for (auto _ : state) {
+        auto measurements = algorithm(get_data(evt.clusters),
+                                      vecmem::get_data(evt.modules));
+        ::benchmark::DoNotOptimize(measurements);
+    }
+    state.counters["clusters"] = static_cast<double>(evt.clusters.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.clusters.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, measurement_creation)
+    ->Apply(toy_detector_benchmark::occupancies);
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, spacepoint_formation)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    host::spacepoint_formation_algorithm algorithm(host_mr());
+
+    for (auto _ : state) {
+        auto spacepoints = algorithm(vecmem::get_data(evt.measurements),
+                                     vecmem::get_data(evt.modules));
+        ::benchmark::DoNotOptimize(spacepoints);
+    }
+    state.counters["measurements"] =
+        static_cast<double>(evt.measurements.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.measurements.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, spacepoint_formation)
+    ->Apply(toy_detector_benchmark::occupancies);
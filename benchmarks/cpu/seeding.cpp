@@ -0,0 +1,92 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/seeding/seed_finding.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+
+// Benchmark include(s).
+#include "benchmarks/toy_detector_benchmark.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+using namespace traccc;
+using traccc::benchmarks::toy_detector_benchmark;
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, spacepoint_binning)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    spacepoint_binning algorithm(finder_config(), grid_config(), host_mr());
+
+    for (auto _ : state) {
+        auto grid = algorithm(evt.spacepoints);
+        ::benchmark::DoNotOptimize(grid);
+    }
+    state.counters["spacepoints"] = static_cast<double>(evt.spacepoints.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.spacepoints.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, spacepoint_binning)
+    ->Apply(toy_detector_benchmark::occupancies);
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, spacepoint_binning_grids)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    spacepoint_binning algorithm(finder_config(), grid_config(), host_mr());
+
+    for (auto _ : state) {
+        auto grids = algorithm.make_grids(evt.spacepoints);
+        ::benchmark::DoNotOptimize(grids);
+    }
+    state.counters["spacepoints"] = static_cast<double>(evt.spacepoints.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.spacepoints.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, spacepoint_binning_grids)
+    ->Apply(toy_detector_benchmark::occupancies);
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, seed_finding)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    const spacepoint_binning::grids_type grids =
+        spacepoint_binning{finder_config(), grid_config(), host_mr()}
+            .make_grids(evt.spacepoints);
+    seed_finding algorithm(finder_config(), filter_config());
+
+    for (auto _ : state) {
+        auto seeds = algorithm(evt.spacepoints, grids.grid, grids.soa_grid);
+        ::benchmark::DoNotOptimize(seeds);
+    }
+    state.counters["spacepoints"] = static_cast<double>(evt.spacepoints.size());
+    state.counters["seeds"] = static_cast<double>(evt.seeds.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.spacepoints.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, seed_finding)
+    ->Apply(toy_detector_benchmark::occupancies);
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, track_params_estimation)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    track_params_estimation algorithm(host_mr());
+
+    for (auto _ : state) {
+        auto params = algorithm(evt.spacepoints, evt.seeds, field_vector());
+        ::benchmark::DoNotOptimize(params);
+    }
+    state.counters["seeds"] = static_cast<double>(evt.seeds.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.seeds.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, track_params_estimation)
+    ->Apply(toy_detector_benchmark::occupancies);
@@ -0,0 +1,80 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/finding/finding_algorithm.hpp"
+#include "traccc/fitting/fitting_algorithm.hpp"
+
+// Benchmark include(s).
+#include "benchmarks/toy_detector_benchmark.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+using namespace traccc;
+using traccc::benchmarks::toy_detector_benchmark;
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, finding)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    finding_algorithm_type algorithm(finding_config());
+
+    for (auto _ : state) {
+        auto track_candidates =
+            algorithm(detector(), field(), evt.measurements, evt.params);
+        ::benchmark::DoNotOptimize(track_candidates);
+    }
+    state.counters["seeds"] = static_cast<double>(evt.params.size());
+    state.counters["tracks"] =
+        static_cast<double>(evt.track_candidates.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.params.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, finding)
+    ->Apply(toy_detector_benchmark::occupancies);
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, fitting)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    fitting_algorithm_type algorithm(fitting_config());
+
+    for (auto _ : state) {
+        auto track_states =
+            algorithm(detector(), field(), evt.track_candidates);
+        ::benchmark::DoNotOptimize(track_states);
+    }
+    state.counters["tracks"] =
+        static_cast<double>(evt.track_candidates.size());
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(evt.track_candidates.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, fitting)
+    ->Apply(toy_detector_benchmark::occupancies);
+
+BENCHMARK_DEFINE_F(toy_detector_benchmark, greedy_ambiguity_resolution)
+(::benchmark::State& state) {
+
+    const event_data& evt = event(state);
+    greedy_ambiguity_resolution_algorithm::config_t config;
+    config.verbose_info = false;
+    config.verbose_warning = false;
+    greedy_ambiguity_resolution_algorithm algorithm(config);
+
+    for (auto _ : state) {
+        auto resolved = algorithm(evt.track_states);
+        ::benchmark::DoNotOptimize(resolved);
+    }
+    state.counters["tracks"] = static_cast<double>(evt.track_states.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(evt.track_states.size()));
+}
+BENCHMARK_REGISTER_F(toy_detector_benchmark, greedy_ambiguity_resolution)
+    ->Apply(toy_detector_benchmark::occupancies);
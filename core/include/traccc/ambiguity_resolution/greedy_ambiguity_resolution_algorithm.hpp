@@ -43,6 +43,16 @@ namespace traccc {
 ///  3) Else, remove the track with the highest relative shared hits (i.e.
 ///     shared hits / hits).
 ///  4) Back to square 1.
+///
+/// Tracks only interact with each other when they share measurements. In
+/// parallel mode, the tracks are split into groups of (transitively)
+/// measurement sharing tracks, which are resolved independently and
+/// concurrently. Every group stops once it meets the final state conditions
+/// by itself, and the maximum number of iterations applies to every group
+/// separately. With at most one shared hit allowed (the default), this gives
+/// the same result as the sequential mode. With more shared hits allowed, the
+/// sequential mode may also remove the "worst" tracks of groups that are
+/// already resolved, for as long as other groups are not.
 class greedy_ambiguity_resolution_algorithm
     : public algorithm<track_state_container_types::host(
           const typename track_state_container_types::host&)> {
@@ -88,30 +98,66 @@ class greedy_ambiguity_resolution_algorithm
         /// Associates each track_index with the track's chi2 value
         std::vector<traccc::scalar> track_chi2;
 
-        /// Associates each track_index to the track's (measurement_id)s list
-        std::vector<std::vector<std::size_t>> measurements_per_track;
+        /// The measurements of the tracks are identified by a "measurement
+        /// index", a dense index given to every distinct measurement_id in the
+        /// input. The track <-> measurement associations are stored as flat
+        /// (CSR) arrays, avoiding one allocation per track and measurement.
+
+        /// The measurement indices of track_index are found at
+        /// [measurement_offsets[track_index],
+        ///  measurement_offsets[track_index + 1]) of measurements_per_track
+        std::vector<std::size_t> measurement_offsets;
+
+        /// The (duplicate free) measurement indices of all tracks
+        std::vector<std::size_t> measurements_per_track;
+
+        /// The (track_index)es sharing measurement index i are found at
+        /// [track_offsets[i], track_offsets[i + 1]) of tracks_per_measurement
+        std::vector<std::size_t> track_offsets;
 
-        /// Associates each measurement_id to a set of (track_index)es sharing
-        /// it
-        std::unordered_map<std::size_t, std::set<std::size_t>>
-            tracks_per_measurement;
+        /// The (track_index)es sharing each measurement, including the ones
+        /// already removed by the algorithm
+        std::vector<std::size_t> tracks_per_measurement;
+
+        /// Associates each measurement index to the number of selected tracks
+        /// sharing it
+        std::vector<std::size_t> n_tracks_per_measurement;
 
         /// Associates each track_index to its number of shared measurements
         /// (among other tracks)
         std::vector<std::size_t> shared_measurements_per_track;
 
-        /// Keeps the selected tracks indexes that have not (yet) been removed
-        /// by the algorithm
-        std::set<std::size_t> selected_tracks;
+        /// Tells for each track_index whether the track has not (yet) been
+        /// removed by the algorithm. (Not an @c std::vector<bool>, so that
+        /// separate tracks can be updated concurrently.)
+        std::vector<char> selected_tracks;
+
+        /// Number of selected tracks
+        std::size_t n_selected_tracks{};
+
+        /// Get the number of measurements of a track
+        std::size_t n_measurements(std::size_t track_index) const {
+            return measurement_offsets[track_index + 1] -
+                   measurement_offsets[track_index];
+        }
+
+        /// Tell whether a track is selected
+        bool is_selected(std::size_t track_index) const {
+            return (track_index < selected_tracks.size()) &&
+                   selected_tracks[track_index];
+        }
     };
 
     /// Constructor for the greedy ambiguity resolution algorithm
     ///
     /// @param cfg  Configuration object
+    /// @param parallel Whether to resolve independent groups of tracks
+    ///                 concurrently (using TBB)
     // greedy_ambiguity_resolution_algorithm(const config_type& cfg) :
     // _config(cfg) {}
-    greedy_ambiguity_resolution_algorithm(const config_t cfg = {})
-        : _config{cfg} {}
+    greedy_ambiguity_resolution_algorithm(const config_t cfg = {},
+                                          bool parallel = false)
+        : _config{cfg}, m_parallel{parallel} {}
 
     /// Run the algorithm
     ///
@@ -121,18 +167,39 @@ class greedy_ambiguity_resolution_algorithm
         const typename track_state_container_types::host& track_states)
         const override;
 
+    /// Run the algorithm on compact track candidates
+    ///
+    /// @param fit_results the fitting results of the tracks, one for each
+    ///                    track candidate
+    /// @param track_candidates the (compact) candidates of the fitted tracks
+    /// @param measurements the measurements referred to by the candidates
+    /// @return the compact track candidates without ambiguous tracks
+    compact_track_candidate_container_types::host operator()(
+        const vecmem::vector<fitting_result<default_algebra>>& fit_results,
+        const compact_track_candidate_container_types::host& track_candidates,
+        const measurement_collection_types::host& measurements) const;
+
+    /// Run the algorithm on compact fitted tracks
+    ///
+    /// @param track_states the container of the compact fitted track states
+    /// @param measurements the measurements referred to by the track states
+    /// @return the container without ambiguous tracks
+    compact_track_state_container_types::host operator()(
+        const compact_track_state_container_types::host& track_states,
+        const measurement_collection_types::host& measurements) const;
+
     private:
     /// Computes the initial state for the input data. This function accumulates
     /// information that will later be used to accelerate the ambiguity
     /// resolution.
     ///
-    /// @param track_states The input track container (output of the fitting
-    /// algorithm).
+    /// @param tracks Accessor to the chi2 and measurement_id-s of the input
+    /// tracks (output of the fitting algorithm).
     /// @param state An empty state object which is expected to be default
     /// constructed.
-    void compute_initial_state(
-        const typename track_state_container_types::host& track_states,
-        state_t& state) const;
+    template <typename track_accessor_t>
+    void compute_initial_state(const track_accessor_t& tracks,
+                               state_t& state) const;
 
     /// Updates the state iteratively by evicting one track after the other
     /// until the final state conditions are met.
@@ -141,21 +208,37 @@ class greedy_ambiguity_resolution_algorithm
     /// initialization.
     void resolve(state_t& state) const;
 
+    /// Evicts tracks from a group of tracks, not sharing any measurement with
+    /// the tracks outside of the group, until the final state conditions are
+    /// met for the group.
+    ///
+    /// @param state A state object that was previously filled by the
+    /// initialization.
+    /// @param first Pointer to the first (track_index) of the group
+    /// @param last Pointer past the last (track_index) of the group
+    /// @param debug_log The stream to write the debug messages to
+    /// @return The number of tracks removed from the group
+    std::size_t resolve_tracks(state_t& state, const std::size_t* first,
+                               const std::size_t* last,
+                               std::ostream& debug_log) const;
+
     /// Check for obvious errors returned by the algorithm:
     /// - Returned tracks should be independent of each other: they should share
     ///   a maximum of (_config.maximum_shared_hits - 1) hits per track.
     /// - Each removed track should share at least (_config.maximum_shared_hits)
     ///   with another initial track.
     ///
-    /// @param initial_track_states The input track container, as given to
+    /// @param initial_tracks The input tracks, as given to
     /// compute_initial_state.
     /// @param final_state The state object after the resolve method has been
     /// called.
-    bool check_obvious_errors(
-        const typename track_state_container_types::host& initial_track_states,
-        state_t& final_state) const;
+    template <typename track_accessor_t>
+    bool check_obvious_errors(const track_accessor_t& initial_tracks,
+                              state_t& final_state) const;
 
     config_t _config;
+    /// Whether to resolve independent groups of tracks concurrently
+    bool m_parallel;
 };
 
 }  // namespace traccc
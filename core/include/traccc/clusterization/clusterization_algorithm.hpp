@@ -27,6 +27,12 @@ namespace traccc::host {
 /// This algorithm creates local/2D measurements separately for each detector
 /// module from the cells of the modules.
 ///
+/// In its parallel mode the cells of the event are partitioned at module
+/// boundaries, and the modules are clusterized concurrently using TBB. The
+/// measurements are written into preallocated, per-module ranges of the
+/// output (found using a prefix sum over the number of clusters per module),
+/// so the result is identical to that of the sequential mode.
+///
 class clusterization_algorithm
     : public algorithm<measurement_collection_types::host(
           const cell_collection_types::const_view&,
@@ -36,8 +42,11 @@ class clusterization_algorithm
     /// Clusterization algorithm constructor
     ///
     /// @param mr The memory resource to use for the result objects
+    /// @param parallel Whether to process the detector modules of the event
+    ///                 concurrently
     ///
-    clusterization_algorithm(vecmem::memory_resource& mr);
+    clusterization_algorithm(vecmem::memory_resource& mr,
+                             bool parallel = false);
 
     /// Construct measurements for each detector module
     ///
@@ -50,6 +59,11 @@ class clusterization_algorithm
                                modules_view) const override;
 
     private:
+    /// Construct measurements, processing the modules concurrently
+    output_type parallel_clusterization(
+        const cell_collection_types::const_view& cells_view,
+        const cell_module_collection_types::const_view& modules_view) const;
+
     /// @name Sub-algorithms used by this algorithm
     /// @{
 
@@ -64,6 +78,9 @@ class clusterization_algorithm
     /// Reference to the host-accessible memory resource
     std::reference_wrapper<vecmem::memory_resource> m_mr;
 
+    /// Whether to process the detector modules concurrently
+    bool m_parallel;
+
 };  // class clusterization_algorithm
 
 }  // namespace traccc::host
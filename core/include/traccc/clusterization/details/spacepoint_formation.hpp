@@ -25,6 +25,17 @@ TRACCC_HOST_DEVICE inline void fill_spacepoint(spacepoint& sp,
                                                const measurement& meas,
                                                const cell_module& mod);
 
+/// Function helping with filling/setting up a slim spacepoint object
+///
+/// @param sp The slim spacepoint to fill / set up
+/// @param meas The measurement to create the spacepoint out of
+/// @param meas_link The index of @c meas in its collection
+/// @param mod The module that the measurement belongs to
+///
+TRACCC_HOST_DEVICE inline void fill_spacepoint(
+    slim_spacepoint& sp, const measurement& meas,
+    slim_spacepoint::link_type meas_link, const cell_module& mod);
+
 }  // namespace traccc::details
 
 // Include the implementation.
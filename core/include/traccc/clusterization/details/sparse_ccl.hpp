@@ -30,6 +30,20 @@ namespace traccc::details {
 TRACCC_HOST_DEVICE inline unsigned int find_root(
     const vecmem::device_vector<unsigned int>& labels, unsigned int e);
 
+/// Find root of the tree for entry @param e, compressing the path to it
+///
+/// Every visited entry is re-pointed to its grandparent (path halving), so
+/// that later look-ups of the same tree become cheaper. Since entries only
+/// ever point to entries with a lower index, this keeps the table usable by
+/// @c traccc::details::assign_labels.
+///
+/// @param labels an equivalance table
+///
+/// @return the root of @param e
+///
+TRACCC_HOST_DEVICE inline unsigned int find_root_compress(
+    vecmem::device_vector<unsigned int>& labels, unsigned int e);
+
 /// Create a union of two entries @param e1 and @param e2
 ///
 /// @param labels an equivalance table
@@ -62,6 +76,19 @@ TRACCC_HOST_DEVICE inline bool is_adjacent(const traccc::cell& a,
 TRACCC_HOST_DEVICE inline bool is_far_enough(const traccc::cell& a,
                                              const traccc::cell& b);
 
+/// Turn an equivalence table into consecutive cluster labels
+///
+/// Clusters are numbered in the order of their first cell.
+///
+/// @param labels is the equivalence table, with every entry pointing to an
+///               entry with a lower (or its own) index; replaced with the
+///               cluster labels on output
+/// @param n_cells is the number of cells (entries) in the table
+/// @return number of clusters
+///
+TRACCC_HOST_DEVICE inline unsigned int assign_labels(
+    vecmem::device_vector<unsigned int>& labels, unsigned int n_cells);
+
 /// Sparce CCL algorithm
 ///
 /// @param cells is the cell collection
@@ -73,6 +100,24 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     const cell_collection_types::const_device& cells,
     vecmem::device_vector<unsigned int>& labels);
 
+/// Row sweep CCL algorithm
+///
+/// Makes use of the cells being sorted by module, then by @c channel1 and
+/// then by @c channel0. Every cell is only compared to the cell preceding it
+/// in its own row, and to the (at most three) touching cells of the row
+/// before it, using a path-compressing union-find. This makes the algorithm
+/// linear in the number of cells, while producing the same labels as
+/// @c traccc::details::sparse_ccl.
+///
+/// @param cells is the cell collection
+/// @param labels is the vector of the output indices (to which cluster a cell
+///               belongs to)
+/// @return number of clusters
+///
+TRACCC_HOST_DEVICE inline unsigned int sparse_ccl_row_sweep(
+    const cell_collection_types::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels);
+
 }  // namespace traccc::details
 
 // Include the implementation.
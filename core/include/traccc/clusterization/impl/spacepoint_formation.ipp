@@ -22,4 +22,14 @@ TRACCC_HOST_DEVICE inline void fill_spacepoint(spacepoint& sp,
     sp.meas = meas;
 }
 
+TRACCC_HOST_DEVICE inline void fill_spacepoint(
+    slim_spacepoint& sp, const measurement& meas,
+    slim_spacepoint::link_type meas_link, const cell_module& mod) {
+
+    // Transform measurement position to 3D
+    const point3 local_3d = {meas.local[0], meas.local[1], 0.f};
+    sp.global = mod.placement.point_to_global(local_3d);
+    sp.meas_link = meas_link;
+}
+
 }  // namespace traccc::details
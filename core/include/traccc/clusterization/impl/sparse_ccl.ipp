@@ -24,6 +24,19 @@ TRACCC_HOST_DEVICE inline unsigned int find_root(
     return r;
 }
 
+TRACCC_HOST_DEVICE inline unsigned int find_root_compress(
+    vecmem::device_vector<unsigned int>& labels, unsigned int e) {
+
+    unsigned int r = e;
+    assert(r < labels.size());
+    while (labels[r] != r) {
+        assert(labels[r] < labels.size());
+        labels[r] = labels[labels[r]];
+        r = labels[r];
+    }
+    return r;
+}
+
 TRACCC_HOST_DEVICE inline unsigned int make_union(
     vecmem::device_vector<unsigned int>& labels, unsigned int e1,
     unsigned int e2) {
@@ -56,12 +69,26 @@ TRACCC_HOST_DEVICE inline bool is_far_enough(const traccc::cell& a,
     return (a.channel1 > (b.channel1 + 1)) || (a.module_link != b.module_link);
 }
 
+TRACCC_HOST_DEVICE inline unsigned int assign_labels(
+    vecmem::device_vector<unsigned int>& labels, unsigned int n_cells) {
+
+    unsigned int nlabels = 0;
+
+    for (unsigned int i = 0; i < n_cells; ++i) {
+        if (labels[i] == i) {
+            labels[i] = nlabels++;
+        } else {
+            labels[i] = labels[labels[i]];
+        }
+    }
+
+    return nlabels;
+}
+
 TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     const cell_collection_types::const_device& cells,
     vecmem::device_vector<unsigned int>& labels) {
 
-    unsigned int nlabels = 0;
-
     // The number of cells.
     const unsigned int n_cells = cells.size();
 
@@ -80,15 +107,67 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     }
 
     // second scan: transitive closure
+    return assign_labels(labels, n_cells);
+}
+
+TRACCC_HOST_DEVICE inline unsigned int sparse_ccl_row_sweep(
+    const cell_collection_types::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels) {
+
+    // The number of cells.
+    const unsigned int n_cells = cells.size();
+
+    // The first cell of the current row, and the range of cells in the row
+    // directly before it (on the same module) that may still touch cells of
+    // the current row.
+    unsigned int row_begin = 0;
+    unsigned int prev_begin = 0;
+    unsigned int prev_end = 0;
+
+    // first scan: pixel association
     for (unsigned int i = 0; i < n_cells; ++i) {
-        if (labels[i] == i) {
-            labels[i] = nlabels++;
-        } else {
-            labels[i] = labels[labels[i]];
+        labels[i] = i;
+        const traccc::cell& c = cells[i];
+
+        if (i > 0) {
+            const traccc::cell& p = cells[i - 1];
+            if ((p.module_link == c.module_link) &&
+                (p.channel1 == c.channel1)) {
+                // Same row: only the previous cell can be adjacent.
+                if (c.channel0 <= p.channel0 + 1) {
+                    make_union(labels, find_root_compress(labels, i),
+                               find_root_compress(labels, i - 1));
+                }
+            } else {
+                // New row: the current row becomes the previous one, if the
+                // two are neighbours on the same module.
+                if ((p.module_link == c.module_link) &&
+                    (p.channel1 + 1 == c.channel1)) {
+                    prev_begin = row_begin;
+                    prev_end = i;
+                } else {
+                    prev_begin = i;
+                    prev_end = i;
+                }
+                row_begin = i;
+            }
+        }
+
+        // Cells of the previous row left of this cell's neighbourhood can not
+        // touch any later cell of this row either.
+        while ((prev_begin < prev_end) &&
+               (cells[prev_begin].channel0 + 1 < c.channel0)) {
+            ++prev_begin;
+        }
+        for (unsigned int j = prev_begin;
+             (j < prev_end) && (cells[j].channel0 <= c.channel0 + 1); ++j) {
+            make_union(labels, find_root_compress(labels, i),
+                       find_root_compress(labels, j));
         }
     }
 
-    return nlabels;
+    // second scan: transitive closure
+    return assign_labels(labels, n_cells);
 }
 
 }  // namespace traccc::details
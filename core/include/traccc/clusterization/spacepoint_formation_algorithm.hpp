@@ -51,6 +51,17 @@ class spacepoint_formation_algorithm
         const cell_module_collection_types::const_view& modules_view)
         const override;
 
+    /// Form slim spacepoints, referring to the measurements by index
+    ///
+    /// @param measurements_view A collection of measurements
+    /// @param modules_view A collection of modules the measurements link to
+    /// @return A slim spacepoint collection, with one spacepoint for every
+    ///         measurement
+    ///
+    slim_spacepoint_collection_types::host form_slim(
+        const measurement_collection_types::const_view& measurements_view,
+        const cell_module_collection_types::const_view& modules_view) const;
+
     private:
     std::reference_wrapper<vecmem::memory_resource> m_mr;
 
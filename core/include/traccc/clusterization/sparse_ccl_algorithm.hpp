@@ -29,11 +29,25 @@ class sparse_ccl_algorithm : public algorithm<cluster_container_types::host(
                                  const cell_collection_types::const_view&)> {
 
     public:
+    /// The connected component labelling implementations to choose from
+    ///
+    /// Both of them produce identical cluster labels.
+    ///
+    enum class method {
+        /// Comparison of every cell with all preceding cells in its
+        /// neighbourhood (original SparseCCL scan)
+        pairwise,
+        /// Linear row sweep with a path-compressing union-find
+        row_sweep
+    };
+
     /// Constructor for component_connection
     ///
     /// @param mr is the memory resource
+    /// @param m is the labelling implementation to use
     ///
-    sparse_ccl_algorithm(vecmem::memory_resource& mr);
+    sparse_ccl_algorithm(vecmem::memory_resource& mr,
+                         method m = method::row_sweep);
 
     /// @name Operator(s) to use in host code
     /// @{
@@ -52,6 +66,8 @@ class sparse_ccl_algorithm : public algorithm<cluster_container_types::host(
     private:
     /// The memory resource used by the algorithm
     std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// The labelling implementation used by the algorithm
+    method m_method;
 
 };  // class sparse_ccl_algorithm
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -34,7 +34,9 @@ struct internal_spacepoint {
 
     internal_spacepoint() = default;
 
-    TRACCC_HOST_DEVICE internal_spacepoint(const spacepoint_t& sp,
+    /// Construct from any spacepoint type providing a global position
+    template <typename other_spacepoint_t>
+    TRACCC_HOST_DEVICE internal_spacepoint(const other_spacepoint_t& sp,
                                            const link_type sp_link,
                                            const vector2& offsetXY)
         : m_link(sp_link) {
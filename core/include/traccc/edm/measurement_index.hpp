@@ -0,0 +1,146 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/measurement.hpp"
+
+// Detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
+namespace traccc {
+
+/// Range of measurements belonging to one detector surface
+///
+/// The measurements of the surface are found at indices
+/// <tt>[begin, end)</tt> of the (sorted) measurement collection.
+///
+struct measurement_range {
+    /// Index of the first measurement on the surface
+    unsigned int begin = 0u;
+    /// Index after the last measurement on the surface
+    unsigned int end = 0u;
+
+    /// Get the number of measurements in the range
+    TRACCC_HOST_DEVICE
+    unsigned int size() const { return end - begin; }
+};
+
+/// Declare all measurement index collection types
+///
+/// A measurement index holds one @c traccc::measurement_range per detector
+/// surface, indexed by the surface's (detray) index. It allows looking up
+/// the measurements of a surface in constant time, in both host and device
+/// code. It is built once per event with @c traccc::make_measurement_index
+/// on the host, or with @c traccc::fill_measurement_index from device code.
+///
+using measurement_index_collection_types = collection_types<measurement_range>;
+
+/// Functor extracting the surface index of a measurement
+struct measurement_surface_index {
+    TRACCC_HOST_DEVICE
+    unsigned int operator()(const measurement& meas) const {
+        return static_cast<unsigned int>(meas.surface_link.index());
+    }
+};
+
+/// Look up the measurements of a surface in a measurement index
+///
+/// @param index The measurement index
+/// @param bcd   The barcode of the surface
+/// @return The range of measurements on the surface (empty if there are none)
+///
+template <typename index_t>
+TRACCC_HOST_DEVICE inline measurement_range get_measurement_range(
+    const index_t& index, const detray::geometry::barcode& bcd) {
+
+    const unsigned int sf_idx = static_cast<unsigned int>(bcd.index());
+    if (sf_idx >= index.size()) {
+        return {};
+    }
+    return index[sf_idx];
+}
+
+/// Fill the measurement index with the information of one measurement
+///
+/// The measurements need to be grouped by surface, as they are after
+/// sorting them with @c traccc::measurement_sort_comp. The index must be
+/// large enough for all surfaces, and its elements must be zero-initialised
+/// beforehand.
+///
+/// @param globalIndex  The index of the measurement to process
+/// @param measurements All measurements of the event
+/// @param index        The measurement index to fill
+///
+TRACCC_HOST_DEVICE inline void fill_measurement_index(
+    std::size_t globalIndex,
+    const measurement_collection_types::const_device& measurements,
+    measurement_index_collection_types::device& index) {
+
+    const unsigned int n_measurements = measurements.size();
+    if (globalIndex >= n_measurements) {
+        return;
+    }
+    const unsigned int i = static_cast<unsigned int>(globalIndex);
+
+    // The first and last measurements of every surface set the boundaries of
+    // the range of that surface.
+    const measurement_surface_index get_index;
+    const unsigned int sf_idx = get_index(measurements.at(i));
+    if ((i == 0u) || (get_index(measurements.at(i - 1)) != sf_idx)) {
+        index.at(sf_idx).begin = i;
+    }
+    if ((i + 1 == n_measurements) ||
+        (get_index(measurements.at(i + 1)) != sf_idx)) {
+        index.at(sf_idx).end = i + 1;
+    }
+}
+
+/// Build the measurement index of an event on the host
+///
+/// @param measurements_view All measurements of the event, grouped by
+///                          surface
+/// @param mr                The memory resource to use for the index
+/// @param n_surfaces        The number of surfaces in the detector. The index
+///                          is made larger if the measurements require it.
+/// @return The measurement index of the event
+///
+inline measurement_index_collection_types::host make_measurement_index(
+    const measurement_collection_types::const_view& measurements_view,
+    vecmem::memory_resource& mr, std::size_t n_surfaces = 0u) {
+
+    const measurement_collection_types::const_device measurements(
+        measurements_view);
+
+    // Size of the index.
+    const measurement_surface_index get_index;
+    for (const measurement& meas : measurements) {
+        n_surfaces =
+            std::max(n_surfaces, static_cast<std::size_t>(get_index(meas)) + 1);
+    }
+
+    // Create and fill the index.
+    measurement_index_collection_types::host index(n_surfaces, &mr);
+    measurement_index_collection_types::device index_device(
+        vecmem::get_data(index));
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+        fill_measurement_index(i, measurements, index_device);
+    }
+    return index;
+}
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -17,6 +17,7 @@
 
 // System include(s).
 #include <cmath>
+#include <cstdint>
 
 namespace traccc {
 
@@ -70,4 +71,57 @@ inline bool operator==(const spacepoint& lhs, const spacepoint& rhs) {
 /// Declare all spacepoint collection types
 using spacepoint_collection_types = collection_types<spacepoint>;
 
+/// A spacepoint referring to its measurement by index
+///
+/// Unlike @c traccc::spacepoint, it does not hold a copy of the measurement
+/// that it was created from, only the index of that measurement in the
+/// measurement collection of the event. Which makes it much smaller, and
+/// cheaper to move around during the seeding.
+///
+struct slim_spacepoint {
+
+    using link_type = std::uint32_t;
+
+    /// The global position of the spacepoint in 3D space
+    point3 global{0., 0., 0.};
+    /// Index of the measurement in the measurement collection
+    link_type meas_link = 0u;
+
+    TRACCC_HOST_DEVICE
+    const scalar& x() const { return global[0]; }
+    TRACCC_HOST_DEVICE
+    const scalar& y() const { return global[1]; }
+    TRACCC_HOST_DEVICE
+    const scalar& z() const { return global[2]; }
+    TRACCC_HOST_DEVICE
+    scalar radius() const {
+        return std::sqrt(global[0] * global[0] + global[1] * global[1]);
+    }
+
+    /// Get the measurement of the spacepoint
+    ///
+    /// @param measurements The measurement collection of the event (host or
+    ///                     device)
+    ///
+    template <typename measurement_collection_t>
+    TRACCC_HOST_DEVICE const measurement& get_measurement(
+        const measurement_collection_t& measurements) const {
+        return measurements.at(meas_link);
+    }
+};
+
+/// Equality operator for slim spacepoints
+TRACCC_HOST_DEVICE
+inline bool operator==(const slim_spacepoint& lhs,
+                       const slim_spacepoint& rhs) {
+
+    return ((math::fabs(lhs.x() - rhs.x()) < float_epsilon) &&
+            (math::fabs(lhs.y() - rhs.y()) < float_epsilon) &&
+            (math::fabs(lhs.z() - rhs.z()) < float_epsilon) &&
+            (lhs.meas_link == rhs.meas_link));
+}
+
+/// Declare all slim spacepoint collection types
+using slim_spacepoint_collection_types = collection_types<slim_spacepoint>;
+
 }  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,12 +8,17 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/track_parameters.hpp"
 
 // Detray include(s).
 #include "detray/geometry/barcode.hpp"
 
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+
 namespace traccc {
 
 /// Track candidate is the measurement
@@ -25,4 +30,59 @@ using track_candidate_collection_types = collection_types<track_candidate>;
 using track_candidate_container_types =
     container_types<bound_track_parameters, track_candidate>;
 
+/// Compact track candidate, referring to a measurement of the event
+///
+/// Only stores the index of the measurement in the event's measurement
+/// collection, instead of a full copy of it.
+///
+struct compact_track_candidate {
+
+    using link_type = std::uint32_t;
+
+    /// Index of the measurement in the measurement collection
+    link_type meas_link;
+
+    /// Get the measurement of the candidate
+    ///
+    /// @param measurements The measurement collection of the event (host or
+    ///                     device)
+    ///
+    template <typename measurement_collection_t>
+    TRACCC_HOST_DEVICE const measurement& get_measurement(
+        const measurement_collection_t& measurements) const {
+        return measurements.at(meas_link);
+    }
+};
+
+/// Declare a compact track candidates collection types
+using compact_track_candidate_collection_types =
+    collection_types<compact_track_candidate>;
+/// Declare a compact track candidates container type
+using compact_track_candidate_container_types =
+    container_types<bound_track_parameters, compact_track_candidate>;
+
+/// Create full track candidates out of compact ones
+///
+/// @param compact_candidates The compact track candidates
+/// @param measurements The measurements referred to by the candidates
+/// @return The track candidates, holding copies of the measurements
+///
+inline track_candidate_container_types::host make_track_candidates(
+    const compact_track_candidate_container_types::host& compact_candidates,
+    const measurement_collection_types::host& measurements) {
+
+    track_candidate_container_types::host result;
+    result.reserve(compact_candidates.size());
+    for (std::size_t i = 0; i < compact_candidates.size(); ++i) {
+        const auto& compact_cands = compact_candidates.at(i).items;
+        vecmem::vector<track_candidate> cands;
+        cands.reserve(compact_cands.size());
+        for (const compact_track_candidate& cand : compact_cands) {
+            cands.push_back(cand.get_measurement(measurements));
+        }
+        result.push_back(compact_candidates.at(i).header, std::move(cands));
+    }
+    return result;
+}
+
 }  // namespace traccc
\ No newline at end of file
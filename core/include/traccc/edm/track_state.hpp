@@ -17,6 +17,9 @@
 #include "detray/navigation/navigator.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 
+// System include(s).
+#include <cstdint>
+
 namespace traccc {
 
 /// Fitting result per track
@@ -219,4 +222,69 @@ using track_state_container_types =
     container_types<fitting_result<default_algebra>,
                     track_state<default_algebra>>;
 
+/// Compact fitting result per measurement
+///
+/// Only keeps the smoothed track parameters and chi square of a fitted track
+/// state, and refers to its measurement by index, dropping the predicted and
+/// filtered parameters, and the transport jacobian, that are only needed
+/// during the fit itself.
+///
+template <typename algebra_t>
+struct compact_track_state {
+
+    using link_type = std::uint32_t;
+    using scalar_type = detray::dscalar<algebra_t>;
+    using bound_track_parameters_type =
+        detray::bound_track_parameters<algebra_t>;
+
+    compact_track_state() = default;
+
+    /// Construction out of a fitted track state
+    ///
+    /// @param state The (smoothed) track state
+    /// @param link The index of the measurement of @c state
+    ///
+    TRACCC_HOST_DEVICE
+    compact_track_state(const track_state<algebra_t>& state, link_type link)
+        : smoothed(state.smoothed()),
+          smoothed_chi2(state.smoothed_chi2()),
+          meas_link(link),
+          is_hole(state.is_hole) {}
+
+    /// @return the surface link
+    TRACCC_HOST_DEVICE
+    inline detray::geometry::barcode surface_link() const {
+        return smoothed.surface_link();
+    }
+
+    /// Get the measurement of the track state
+    ///
+    /// @param measurements The measurement collection of the event (host or
+    ///                     device)
+    ///
+    template <typename measurement_collection_t>
+    TRACCC_HOST_DEVICE const measurement& get_measurement(
+        const measurement_collection_t& measurements) const {
+        return measurements.at(meas_link);
+    }
+
+    /// The smoothed track parameters
+    bound_track_parameters_type smoothed;
+    /// Chi square of the smoothed track parameters
+    scalar_type smoothed_chi2 = 0.f;
+    /// Index of the measurement in the measurement collection
+    link_type meas_link = 0u;
+    /// Whether the measurement was not used in the fit
+    bool is_hole{true};
+};
+
+/// Declare all compact track_state collection types
+using compact_track_state_collection_types =
+    collection_types<compact_track_state<default_algebra>>;
+
+/// Declare all compact track_state container types
+using compact_track_state_container_types =
+    container_types<fitting_result<default_algebra>,
+                    compact_track_state<default_algebra>>;
+
 }  // namespace traccc
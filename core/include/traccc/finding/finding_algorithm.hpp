@@ -10,8 +10,10 @@
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
 #include "traccc/edm/track_candidate.hpp"
 #include "traccc/edm/track_state.hpp"
+#include "traccc/finding/candidate_link.hpp"
 #include "traccc/finding/ckf_aborter.hpp"
 #include "traccc/finding/finding_config.hpp"
 #include "traccc/finding/interaction_register.hpp"
@@ -33,6 +35,10 @@
 // Thrust Library
 #include <thrust/pair.h>
 
+// System include(s).
+#include <cstddef>
+#include <vector>
+
 namespace traccc {
 
 /// Track Finding algorithm for a set of tracks
@@ -77,8 +83,10 @@ class finding_algorithm
     /// Constructor for the finding algorithm
     ///
     /// @param cfg  Configuration object
-    /// @param mr   The memory resource to use
-    finding_algorithm(const config_type& cfg) : m_cfg(cfg) {}
+    /// @param parallel Whether to process the track parameters of every step
+    ///                 concurrently (using TBB)
+    finding_algorithm(const config_type& cfg, bool parallel = false)
+        : m_cfg(cfg), m_parallel(parallel) {}
 
     /// Get config object (const access)
     const finding_config<scalar_type>& get_config() const { return m_cfg; }
@@ -93,9 +101,79 @@ class finding_algorithm
         const measurement_collection_types::host& measurements,
         const bound_track_parameters_collection_types::host& seeds) const;
 
+    /// Run the algorithm, creating compact track candidates
+    ///
+    /// The candidates only hold the indices of their measurements in
+    /// @c measurements, instead of copies of them.
+    ///
+    /// @param det    Detector
+    /// @param measurements  Input measurements
+    /// @param seeds  Input seeds
+    compact_track_candidate_container_types::host find_compact(
+        const detector_type& det, const bfield_type& field,
+        const measurement_collection_types::host& measurements,
+        const bound_track_parameters_collection_types::host& seeds) const;
+
     private:
+    /// What to do with a link after the Kalman update step
+    enum class link_action : char { none, tip, propagate };
+
+    /// Links found for a chunk of input parameters
+    struct chunk_output {
+        /// Links created from the input parameters
+        std::vector<candidate_link> links;
+        /// Parameters updated by the Kalman filter, one per link
+        std::vector<bound_track_parameters> updated_params;
+    };
+
+    /// Number of input parameters to process in one chunk
+    static constexpr std::size_t chunk_size = 16u;
+
+    /// Find the measurements compatible with one input parameter
+    ///
+    /// @param det            Detector
+    /// @param measurements   Input measurements
+    /// @param meas_index     Index of the measurements on every surface
+    /// @param in_param       The input parameter
+    /// @param in_param_id    The index of the input parameter
+    /// @param previous_step  The index of the previous step
+    /// @param previous_link  The link of the input parameter in the previous
+    ///                       step (@c nullptr in the first step)
+    /// @param output         The output to append the new links to
+    void find_branches(const detector_type& det,
+                       const measurement_collection_types::host& measurements,
+                       const measurement_index_collection_types::host&
+                           meas_index,
+                       bound_track_parameters& in_param,
+                       unsigned int in_param_id, int previous_step,
+                       const candidate_link* previous_link,
+                       chunk_output& output) const;
+
+    /// Propagate a track parameter to the next surface
+    ///
+    /// @param propagator  The propagator to use
+    /// @param det         Detector
+    /// @param field       Magnetic field
+    /// @param param       The parameter to propagate
+    /// @param out_param   The parameter on the next surface (if found)
+    /// @return Whether a next surface was found
+    bool propagate_to_next_surface(propagator_type& propagator,
+                                   const detector_type& det,
+                                   const bfield_type& field,
+                                   const bound_track_parameters& param,
+                                   bound_track_parameters& out_param) const;
+
+    /// Run a function on the index range <tt>[0, n)</tt>
+    ///
+    /// The function receives sub-ranges of the full range. These are
+    /// processed concurrently in parallel mode.
+    template <typename FUNC>
+    void for_each_range(std::size_t n, FUNC&& func) const;
+
     /// Config object
     config_type m_cfg;
+    /// Whether to process the track parameters concurrently
+    bool m_parallel;
 };
 
 }  // namespace traccc
@@ -12,6 +12,13 @@
 #include "detray/geometry/barcode.hpp"
 #include "detray/geometry/surface.hpp"
 
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 // System include
 #include <algorithm>
 #include <limits>
@@ -25,40 +32,27 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
     const measurement_collection_types::host& measurements,
     const bound_track_parameters_collection_types::host& seeds) const {
 
+    return make_track_candidates(find_compact(det, field, measurements, seeds),
+                                 measurements);
+}
+
+template <typename stepper_t, typename navigator_t>
+compact_track_candidate_container_types::host
+finding_algorithm<stepper_t, navigator_t>::find_compact(
+    const detector_type& det, const bfield_type& field,
+    const measurement_collection_types::host& measurements,
+    const bound_track_parameters_collection_types::host& seeds) const {
+
     /*****************************************************************
      * Measurement Operations
      *****************************************************************/
 
-    // Get copy of barcode uniques
-    std::vector<measurement> uniques;
-    uniques.resize(measurements.size());
-
-    auto end = std::unique_copy(measurements.begin(), measurements.end(),
-                                uniques.begin(), measurement_equal_comp());
-    const unsigned int n_modules = end - uniques.begin();
-
-    // Get upper bounds of unique elements
-    std::vector<unsigned int> upper_bounds;
-    upper_bounds.reserve(n_modules);
-    for (unsigned int i = 0; i < n_modules; i++) {
-        auto up = std::upper_bound(measurements.begin(), measurements.end(),
-                                   uniques[i], measurement_sort_comp());
-        upper_bounds.push_back(std::distance(measurements.begin(), up));
-    }
+    // Index of the measurements on every surface
+    vecmem::host_memory_resource host_mr;
+    const measurement_index_collection_types::host meas_index =
+        make_measurement_index(vecmem::get_data(measurements), host_mr);
     const auto n_meas = measurements.size();
 
-    // Get the number of measurements of each module
-    std::vector<unsigned int> sizes(n_modules);
-    std::adjacent_difference(upper_bounds.begin(), upper_bounds.end(),
-                             sizes.begin());
-
-    // Create barcode sequence
-    std::vector<detray::geometry::barcode> barcodes;
-    barcodes.reserve(n_modules);
-    for (unsigned int i = 0; i < n_modules; i++) {
-        barcodes.push_back(uniques[i].surface_link);
-    }
-
     std::vector<std::vector<candidate_link>> links;
     links.resize(m_cfg.max_track_candidates_per_track);
 
@@ -67,9 +61,6 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
 
     std::vector<typename candidate_link::link_index_type> tips;
 
-    // Create propagator
-    propagator_type propagator(m_cfg.propagation);
-
     // Copy seed to input parameters
     std::vector<bound_track_parameters> in_params;
     std::vector<unsigned int> n_trks_per_seed(seeds.size(), 0);
@@ -81,6 +72,16 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
 
     std::vector<bound_track_parameters> out_params;
 
+    // Links and updated parameters of the input parameter chunks
+    std::vector<chunk_output> chunk_outputs;
+    // Parameters updated by Kalman fitter
+    std::vector<bound_track_parameters> updated_params;
+    // What to do with each link
+    std::vector<link_action> actions;
+    // Results of the propagation of the links
+    std::vector<char> propagation_success;
+    std::vector<bound_track_parameters> propagated_params;
+
     for (int step = 0;
          step < static_cast<int>(m_cfg.max_track_candidates_per_track);
          step++) {
@@ -102,127 +103,66 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
 
         std::fill(n_trks_per_seed.begin(), n_trks_per_seed.end(), 0);
 
-        // Parameters updated by Kalman fitter
-        std::vector<bound_track_parameters> updated_params;
-
-        for (unsigned int in_param_id = 0; in_param_id < n_in_params;
-             in_param_id++) {
-
-            bound_track_parameters& in_param = in_params[in_param_id];
-            unsigned int orig_param_id =
-                (step == 0
-                     ? in_param_id
-                     : links[step - 1][param_to_link[step - 1][in_param_id]]
-                           .seed_idx);
-            unsigned int skip_counter =
-                (step == 0
-                     ? 0
-                     : links[step - 1][param_to_link[step - 1][in_param_id]]
-                           .n_skipped);
-
-            /*************************
-             * Material interaction
-             *************************/
-
-            // Get intersection at surface
-            const detray::surface sf{det, in_param.surface_link()};
-
-            const cxt_t ctx{};
-
-            // Apply interactor
-            typename interactor_type::state interactor_state;
-            interactor_type{}.update(
-                in_param, interactor_state,
-                static_cast<int>(detray::navigation::direction::e_forward), sf,
-                std::abs(
-                    sf.cos_angle(ctx, in_param.dir(), in_param.bound_local())));
-
-            // Get barcode and measurements range on surface
-            const auto bcd = in_param.surface_link();
-            std::pair<unsigned int, unsigned int> range;
-
-            // Find the corresponding index of bcd in barcode vector
-
-            const auto lo2 =
-                std::lower_bound(barcodes.begin(), barcodes.end(), bcd);
-
-            const auto bcd_id = std::distance(barcodes.begin(), lo2);
-
-            if (lo2 == barcodes.begin()) {
-                range.first = 0u;
-                range.second = upper_bounds[bcd_id];
-            } else if (lo2 == barcodes.end()) {
-                range.first = 0u;
-                range.second = 0u;
-            } else {
-                range.first = upper_bounds[bcd_id - 1];
-                range.second = upper_bounds[bcd_id];
-            }
-
-            unsigned int n_branches = 0;
-
-            /*****************************************************************
-             * Find tracks (CKF)
-             *****************************************************************/
-
-            // Iterate over the measurements
-            for (unsigned int item_id = range.first; item_id < range.second;
-                 item_id++) {
-                if (n_branches > m_cfg.max_num_branches_per_surface) {
-                    break;
-                }
-
-                bound_track_parameters bound_param(in_param.surface_link(),
-                                                   in_param.vector(),
-                                                   in_param.covariance());
-                const auto& meas = measurements[item_id];
-
-                track_state<algebra_type> trk_state(meas);
-
-                // Run the Kalman update
-                sf.template visit_mask<gain_matrix_updater<algebra_type>>(
-                    trk_state, bound_param);
-
-                // Get the chi-square
-                const auto chi2 = trk_state.filtered_chi2();
-
-                // Found a good measurement
-                if (chi2 < m_cfg.chi2_max) {
-                    n_branches++;
-
-                    links[step].push_back({{previous_step, in_param_id},
-                                           item_id,
-                                           orig_param_id,
-                                           skip_counter});
-                    updated_params.push_back(trk_state.filtered());
+        /*****************************************************************
+         * Find tracks (CKF)
+         *****************************************************************/
+
+        // The input parameters are processed in fixed size chunks, each
+        // collecting its own links. The chunks are concatenated in order
+        // afterwards, so the link order does not depend on the number of
+        // threads used.
+        const std::size_t n_chunks =
+            (n_in_params + chunk_size - 1) / chunk_size;
+        chunk_outputs.resize(n_chunks);
+        for_each_range(n_chunks, [&](std::size_t chunk_begin,
+                                     std::size_t chunk_end) {
+            for (std::size_t chunk = chunk_begin; chunk < chunk_end;
+                 ++chunk) {
+                chunk_output& output = chunk_outputs[chunk];
+                output.links.clear();
+                output.updated_params.clear();
+                const unsigned int param_end = static_cast<unsigned int>(
+                    std::min((chunk + 1) * chunk_size, n_in_params));
+                for (unsigned int in_param_id =
+                         static_cast<unsigned int>(chunk * chunk_size);
+                     in_param_id < param_end; in_param_id++) {
+
+                    const candidate_link* previous_link =
+                        (step == 0)
+                            ? nullptr
+                            : &(links[step - 1]
+                                     [param_to_link[step - 1][in_param_id]]);
+                    find_branches(det, measurements, meas_index,
+                                  in_params[in_param_id], in_param_id,
+                                  previous_step, previous_link, output);
                 }
             }
+        });
 
-            /*****************************************************************
-             * Add a dummy links in case of no branches
-             *****************************************************************/
-
-            if (n_branches == 0) {
-
-                // Put an invalid link with max item id
-                links[step].push_back({{previous_step, in_param_id},
-                                       std::numeric_limits<unsigned int>::max(),
-                                       orig_param_id,
-                                       skip_counter + 1});
-
-                bound_track_parameters bound_param(in_param.surface_link(),
-                                                   in_param.vector(),
-                                                   in_param.covariance());
-                updated_params.push_back(bound_param);
-                n_branches++;
-            }
+        // Merge the chunk outputs, using the prefix sum of their sizes
+        std::size_t n_links = 0;
+        for (const chunk_output& output : chunk_outputs) {
+            n_links += output.links.size();
+        }
+        links[step].resize(n_links);
+        updated_params.resize(n_links);
+        std::size_t offset = 0;
+        for (const chunk_output& output : chunk_outputs) {
+            std::copy(output.links.begin(), output.links.end(),
+                      links[step].begin() + offset);
+            std::copy(output.updated_params.begin(),
+                      output.updated_params.end(),
+                      updated_params.begin() + offset);
+            offset += output.links.size();
         }
 
         /*********************************
          * Propagate to the next surface
          *********************************/
 
-        const unsigned int n_links = links[step].size();
+        // Select the links to propagate. This has to be done in link order,
+        // as the number of branches per seed is limited.
+        actions.assign(n_links, link_action::none);
         for (unsigned int link_id = 0; link_id < n_links; link_id++) {
 
             const unsigned int seed_idx = links[step][link_id].seed_idx;
@@ -236,43 +176,52 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
             // link to be a tip
             if (links[step][link_id].n_skipped >
                 m_cfg.max_num_skipping_per_cand) {
+                actions[link_id] = link_action::tip;
+                continue;
+            }
+
+            actions[link_id] = link_action::propagate;
+        }
+
+        // Propagate the selected links, independently of each other
+        propagation_success.assign(n_links, 0);
+        propagated_params.resize(n_links);
+        for_each_range(n_links, [&](std::size_t link_begin,
+                                    std::size_t link_end) {
+            // Create propagator
+            propagator_type propagator(m_cfg.propagation);
+
+            for (std::size_t link_id = link_begin; link_id < link_end;
+                 ++link_id) {
+                if (actions[link_id] == link_action::propagate) {
+                    propagation_success[link_id] = propagate_to_next_surface(
+                        propagator, det, field, updated_params[link_id],
+                        propagated_params[link_id]);
+                }
+            }
+        });
+
+        // Collect the results in link order
+        for (unsigned int link_id = 0; link_id < n_links; link_id++) {
+
+            if (actions[link_id] == link_action::tip) {
                 tips.push_back({step, link_id});
+            }
+            if (actions[link_id] != link_action::propagate) {
                 continue;
             }
 
-            const auto& param = updated_params[link_id];
-            // Create propagator state
-            typename propagator_type::state propagation(param, field, det);
-            propagation._stepping
-                .template set_constraint<detray::step::constraint::e_accuracy>(
-                    m_cfg.propagation.stepping.step_constraint);
-
-            typename detray::pathlimit_aborter::state s0;
-            typename detray::parameter_transporter<algebra_type>::state s1;
-            typename interactor::state s3;
-            typename interaction_register<interactor>::state s2{s3};
-            typename ckf_aborter::state s4;
-            s4.min_step_length = m_cfg.min_step_length_for_next_surface;
-            s4.max_count = m_cfg.max_step_counts_for_next_surface;
-
-            // @TODO: Should be removed once detray is fixed to set the
-            // volume in the constructor
-            propagation._navigation.set_volume(param.surface_link().volume());
-
-            // Propagate to the next surface
-            propagator.propagate_sync(propagation,
-                                      std::tie(s0, s1, s2, s3, s4));
+            const bool success = propagation_success[link_id];
 
             // If a surface found, add the parameter for the next
             // step
-            if (s4.success) {
-                out_params.push_back(propagation._stepping._bound_params);
+            if (success) {
+                out_params.push_back(propagated_params[link_id]);
                 param_to_link[step].push_back(link_id);
             }
             // Unless the track found a surface, it is considered a
             // tip
-            else if (!s4.success &&
-                     step >= static_cast<int>(
+            else if (step >= static_cast<int>(
                                  m_cfg.min_track_candidates_per_track) -
                                  1) {
                 tips.push_back({step, link_id});
@@ -280,7 +229,7 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
 
             // If no more CKF step is expected, current candidate is
             // kept as a tip
-            if (s4.success &&
+            if (success &&
                 step == static_cast<int>(m_cfg.max_track_candidates_per_track) -
                             1) {
                 tips.push_back({step, link_id});
@@ -296,7 +245,7 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
      **********************/
 
     // Number of found tracks = number of tips
-    track_candidate_container_types::host output_candidates;
+    compact_track_candidate_container_types::host output_candidates;
     output_candidates.reserve(tips.size());
 
     for (const auto& tip : tips) {
@@ -331,7 +280,7 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
         // Retrieve tip
         L = links[tip.first][tip.second];
 
-        vecmem::vector<track_candidate> cands_per_track;
+        vecmem::vector<compact_track_candidate> cands_per_track;
         cands_per_track.resize(n_cands);
 
         // Reversely iterate to fill the track candidates
@@ -354,8 +303,8 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
                 break;
             }
 
-            auto& cand = *it;
-            cand = measurements.at(L.meas_idx);
+            it->meas_link =
+                static_cast<compact_track_candidate::link_type>(L.meas_idx);
 
             // Break the loop if the iterator is at the first candidate and
             // fill the seed
@@ -378,4 +327,140 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
     return output_candidates;
 }
 
+template <typename stepper_t, typename navigator_t>
+void finding_algorithm<stepper_t, navigator_t>::find_branches(
+    const detector_type& det,
+    const measurement_collection_types::host& measurements,
+    const measurement_index_collection_types::host& meas_index,
+    bound_track_parameters& in_param, unsigned int in_param_id,
+    int previous_step, const candidate_link* previous_link,
+    chunk_output& output) const {
+
+    const unsigned int orig_param_id =
+        (previous_link == nullptr ? in_param_id : previous_link->seed_idx);
+    const unsigned int skip_counter =
+        (previous_link == nullptr ? 0 : previous_link->n_skipped);
+
+    /*************************
+     * Material interaction
+     *************************/
+
+    // Get intersection at surface
+    const detray::surface sf{det, in_param.surface_link()};
+
+    const cxt_t ctx{};
+
+    // Apply interactor
+    typename interactor_type::state interactor_state;
+    interactor_type{}.update(
+        in_param, interactor_state,
+        static_cast<int>(detray::navigation::direction::e_forward), sf,
+        std::abs(sf.cos_angle(ctx, in_param.dir(), in_param.bound_local())));
+
+    // Get the measurements range on surface
+    const measurement_range range =
+        get_measurement_range(meas_index, in_param.surface_link());
+
+    unsigned int n_branches = 0;
+
+    // Iterate over the measurements
+    for (unsigned int item_id = range.begin; item_id < range.end; item_id++) {
+        if (n_branches > m_cfg.max_num_branches_per_surface) {
+            break;
+        }
+
+        bound_track_parameters bound_param(in_param.surface_link(),
+                                           in_param.vector(),
+                                           in_param.covariance());
+        const auto& meas = measurements[item_id];
+
+        track_state<algebra_type> trk_state(meas);
+
+        // Run the Kalman update, for measurements passing the chi2 cut
+        sf.template visit_mask<gain_matrix_updater<algebra_type>>(
+            trk_state, bound_param, m_cfg.chi2_max);
+
+        // Get the chi-square
+        const auto chi2 = trk_state.filtered_chi2();
+
+        // Found a good measurement
+        if (chi2 < m_cfg.chi2_max) {
+            n_branches++;
+
+            output.links.push_back({{previous_step, in_param_id},
+                                    item_id,
+                                    orig_param_id,
+                                    skip_counter});
+            output.updated_params.push_back(trk_state.filtered());
+        }
+    }
+
+    /*****************************************************************
+     * Add a dummy links in case of no branches
+     *****************************************************************/
+
+    if (n_branches == 0) {
+
+        // Put an invalid link with max item id
+        output.links.push_back({{previous_step, in_param_id},
+                                std::numeric_limits<unsigned int>::max(),
+                                orig_param_id,
+                                skip_counter + 1});
+
+        bound_track_parameters bound_param(in_param.surface_link(),
+                                           in_param.vector(),
+                                           in_param.covariance());
+        output.updated_params.push_back(bound_param);
+    }
+}
+
+template <typename stepper_t, typename navigator_t>
+bool finding_algorithm<stepper_t, navigator_t>::propagate_to_next_surface(
+    propagator_type& propagator, const detector_type& det,
+    const bfield_type& field, const bound_track_parameters& param,
+    bound_track_parameters& out_param) const {
+
+    // Create propagator state
+    typename propagator_type::state propagation(param, field, det);
+    propagation._stepping
+        .template set_constraint<detray::step::constraint::e_accuracy>(
+            m_cfg.propagation.stepping.step_constraint);
+
+    typename detray::pathlimit_aborter::state s0;
+    typename detray::parameter_transporter<algebra_type>::state s1;
+    typename interactor::state s3;
+    typename interaction_register<interactor>::state s2{s3};
+    typename ckf_aborter::state s4;
+    s4.min_step_length = m_cfg.min_step_length_for_next_surface;
+    s4.max_count = m_cfg.max_step_counts_for_next_surface;
+
+    // @TODO: Should be removed once detray is fixed to set the
+    // volume in the constructor
+    propagation._navigation.set_volume(param.surface_link().volume());
+
+    // Propagate to the next surface
+    propagator.propagate_sync(propagation, std::tie(s0, s1, s2, s3, s4));
+
+    // If a surface found, return the parameter for the next step
+    if (s4.success) {
+        out_param = propagation._stepping._bound_params;
+    }
+    return s4.success;
+}
+
+template <typename stepper_t, typename navigator_t>
+template <typename FUNC>
+void finding_algorithm<stepper_t, navigator_t>::for_each_range(
+    std::size_t n, FUNC&& func) const {
+
+    if (m_parallel) {
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0u, n),
+                          [&func](const tbb::blocked_range<std::size_t>& r) {
+                              func(r.begin(), r.end());
+                          });
+    } else {
+        func(std::size_t{0u}, n);
+    }
+}
+
 }  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -15,6 +15,15 @@
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+// System include(s).
+#include <cstddef>
+#include <utility>
+
 namespace traccc {
 
 /// Fitting algorithm for a set of tracks
@@ -34,7 +43,9 @@ class fitting_algorithm
     /// Constructor for the fitting algorithm
     ///
     /// @param cfg  Configuration object
-    fitting_algorithm(const config_type& cfg) : m_cfg(cfg) {}
+    /// @param parallel Whether to fit the tracks concurrently (using TBB)
+    fitting_algorithm(const config_type& cfg, bool parallel = false)
+        : m_cfg(cfg), m_parallel(parallel) {}
 
     /// Run the algorithm
     ///
@@ -46,43 +57,227 @@ class fitting_algorithm
         const typename track_candidate_container_types::host& track_candidates)
         const override {
 
-        fitter_t fitter(det, field, m_cfg);
+        return fit_tracks(
+            det, field, track_candidates,
+            [](const track_candidate& cand) -> const measurement& {
+                return cand;
+            });
+    }
 
-        track_state_container_types::host output_states;
+    /// Run the algorithm on compact track candidates
+    ///
+    /// @param track_candidates the candidate measurement indices from track
+    ///                         finding
+    /// @param measurements the measurements referred to by the candidates
+    /// @return the container of the fitted track parameters
+    track_state_container_types::host operator()(
+        const typename fitter_t::detector_type& det,
+        const typename fitter_t::bfield_type& field,
+        const compact_track_candidate_container_types::host& track_candidates,
+        const measurement_collection_types::host& measurements) const {
 
-        // The number of tracks
-        std::size_t n_tracks = track_candidates.size();
+        return fit_tracks(
+            det, field, track_candidates,
+            [&measurements](const compact_track_candidate& cand)
+                -> const measurement& {
+                return cand.get_measurement(measurements);
+            });
+    }
+
+    /// Run the algorithm on compact track candidates, with a compact output
+    ///
+    /// Only the smoothed parameters, the chi square and the measurement
+    /// index of every track state is kept. The full track states, needed
+    /// during the fit, live in scratch memory re-used between the tracks.
+    ///
+    /// @param track_candidates the candidate measurement indices from track
+    ///                         finding
+    /// @param measurements the measurements referred to by the candidates
+    /// @return the container of the (compact) fitted track parameters
+    compact_track_state_container_types::host fit_compact(
+        const typename fitter_t::detector_type& det,
+        const typename fitter_t::bfield_type& field,
+        const compact_track_candidate_container_types::host& track_candidates,
+        const measurement_collection_types::host& measurements) const {
 
-        // Iterate over tracks
-        for (std::size_t i = 0; i < n_tracks; i++) {
+        // The number of tracks
+        const std::size_t n_tracks = track_candidates.size();
 
-            // Seed parameter
-            const auto& seed_param = track_candidates[i].header;
+        // The output container, with one (fitted) element per track
+        compact_track_state_container_types::host output_states;
+        output_states.resize(n_tracks);
 
-            // Make a vector of track state
-            auto& cands = track_candidates[i].items;
-            vecmem::vector<track_state<algebra_type>> input_states;
-            input_states.reserve(cands.size());
-            for (auto& cand : cands) {
-                input_states.emplace_back(cand);
+        if (!m_parallel) {
+            compact_fit_scratch scratch{fitter_t(det, field, m_cfg), {}};
+            for (std::size_t i = 0; i < n_tracks; i++) {
+                fit_track_compact(scratch, track_candidates, measurements, i,
+                                  output_states);
             }
+            return output_states;
+        }
 
-            // Make a fitter state
-            typename fitter_t::state fitter_state(std::move(input_states));
+        // Fit the tracks in parallel, with one fitter and one scratch buffer
+        // per thread.
+        tbb::enumerable_thread_specific<compact_fit_scratch> scratches([&]() {
+            return compact_fit_scratch{fitter_t(det, field, m_cfg), {}};
+        });
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0u, n_tracks),
+                          [&](const tbb::blocked_range<std::size_t>& range) {
+                              compact_fit_scratch& scratch = scratches.local();
+                              for (std::size_t i = range.begin();
+                                   i != range.end(); ++i) {
+                                  fit_track_compact(scratch, track_candidates,
+                                                    measurements, i,
+                                                    output_states);
+                              }
+                          });
 
-            // Run fitter
-            fitter.fit(seed_param, fitter_state);
+        return output_states;
+    }
+
+    private:
+    /// Per-thread memory used by the compact fitting
+    struct compact_fit_scratch {
+        /// The fitter to use
+        fitter_t fitter;
+        /// The full track states of the track being fitted
+        typename fitter_t::template vector_type<track_state<algebra_type>>
+            track_states;
+    };
+
+    /// Fit all tracks of a track candidate container
+    ///
+    /// @param track_candidates the candidates from track finding
+    /// @param get_measurement function returning the measurement of a
+    ///                        candidate
+    /// @return the container of the fitted track parameters
+    template <typename candidates_t, typename get_measurement_t>
+    track_state_container_types::host fit_tracks(
+        const typename fitter_t::detector_type& det,
+        const typename fitter_t::bfield_type& field,
+        const candidates_t& track_candidates,
+        const get_measurement_t& get_measurement) const {
 
-            output_states.push_back(
-                std::move(fitter_state.m_fit_res),
-                std::move(fitter_state.m_fit_actor_state.m_track_states));
+        // The number of tracks
+        const std::size_t n_tracks = track_candidates.size();
+
+        // The output container, with one (fitted) element per track
+        track_state_container_types::host output_states;
+        output_states.resize(n_tracks);
+
+        if (!m_parallel) {
+            fitter_t fitter(det, field, m_cfg);
+            for (std::size_t i = 0; i < n_tracks; i++) {
+                fit_track(fitter, track_candidates, get_measurement, i,
+                          output_states);
+            }
+            return output_states;
         }
 
+        // Fit the tracks in parallel, with one fitter per thread. Every track
+        // writes its result into its own element of the output container, so
+        // the output order is the same as the input order.
+        tbb::enumerable_thread_specific<fitter_t> fitters(
+            [&]() { return fitter_t(det, field, m_cfg); });
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0u, n_tracks),
+                          [&](const tbb::blocked_range<std::size_t>& range) {
+                              fitter_t& fitter = fitters.local();
+                              for (std::size_t i = range.begin();
+                                   i != range.end(); ++i) {
+                                  fit_track(fitter, track_candidates,
+                                            get_measurement, i,
+                                            output_states);
+                              }
+                          });
+
         return output_states;
     }
 
+    /// Fit one track
+    ///
+    /// The track states are created directly in the output container, and
+    /// are moved into the fitter state and back, so that no temporary
+    /// storage is needed.
+    ///
+    /// @param fitter the fitter to use
+    /// @param track_candidates the candidates from track finding
+    /// @param get_measurement function returning the measurement of a
+    ///                        candidate
+    /// @param i the index of the track to fit
+    /// @param output_states the (preallocated) output container
+    template <typename candidates_t, typename get_measurement_t>
+    void fit_track(fitter_t& fitter, const candidates_t& track_candidates,
+                   const get_measurement_t& get_measurement, std::size_t i,
+                   track_state_container_types::host& output_states) const {
+
+        // Seed parameter
+        const auto& seed_param = track_candidates[i].header;
+
+        // Make a vector of track state
+        const auto& cands = track_candidates[i].items;
+        auto& track_states = output_states[i].items;
+        track_states.clear();
+        track_states.reserve(cands.size());
+        for (const auto& cand : cands) {
+            track_states.emplace_back(get_measurement(cand));
+        }
+
+        // Make a fitter state
+        typename fitter_t::state fitter_state(std::move(track_states));
+
+        // Run fitter
+        fitter.fit(seed_param, fitter_state);
+
+        output_states[i].header = std::move(fitter_state.m_fit_res);
+        track_states =
+            std::move(fitter_state.m_fit_actor_state.m_track_states);
+    }
+
+    /// Fit one track, keeping only its compact track states
+    ///
+    /// @param scratch the fitter and scratch memory to use
+    /// @param track_candidates the candidates from track finding
+    /// @param measurements the measurements referred to by the candidates
+    /// @param i the index of the track to fit
+    /// @param output_states the (preallocated) output container
+    void fit_track_compact(
+        compact_fit_scratch& scratch,
+        const compact_track_candidate_container_types::host& track_candidates,
+        const measurement_collection_types::host& measurements, std::size_t i,
+        compact_track_state_container_types::host& output_states) const {
+
+        // Seed parameter
+        const auto& seed_param = track_candidates[i].header;
+
+        // Set up the full track states in the scratch memory
+        const auto& cands = track_candidates[i].items;
+        auto& track_states = scratch.track_states;
+        track_states.clear();
+        track_states.reserve(cands.size());
+        for (const compact_track_candidate& cand : cands) {
+            track_states.emplace_back(cand.get_measurement(measurements));
+        }
+
+        // Run the fitter, moving the scratch memory in and out of its state
+        typename fitter_t::state fitter_state(std::move(track_states));
+        scratch.fitter.fit(seed_param, fitter_state);
+        track_states =
+            std::move(fitter_state.m_fit_actor_state.m_track_states);
+
+        // Keep only the compact track states
+        output_states[i].header = std::move(fitter_state.m_fit_res);
+        auto& compact_states = output_states[i].items;
+        compact_states.clear();
+        compact_states.reserve(track_states.size());
+        for (std::size_t j = 0; j < track_states.size(); ++j) {
+            compact_states.emplace_back(track_states[j], cands[j].meas_link);
+        }
+    }
+
     /// Config object
     config_type m_cfg;
+    /// Whether to fit the tracks concurrently
+    bool m_parallel;
 };
 
 }  // namespace traccc
@@ -21,6 +21,7 @@ struct gain_matrix_updater {
     // Type declarations
     using matrix_operator = detray::dmatrix_operator<algebra_t>;
     using size_type = detray::dsize_type<algebra_t>;
+    using scalar_type = detray::dscalar<algebra_t>;
     template <size_type ROWS, size_type COLS>
     using matrix_type = detray::dmatrix<algebra_t, ROWS, COLS>;
 
@@ -52,11 +53,156 @@ struct gain_matrix_updater {
         }
     }
 
+    /// Gated gain matrix updater operation
+    ///
+    /// Runs the full Kalman update only for measurements whose predicted
+    /// chi-square (see @c predicted_chi2) is below @c chi2_max. For rejected
+    /// measurements only the chi-square is stored in the track state, and
+    /// neither the filtered parameters nor @c bound_params are touched.
+    ///
+    /// @param mask_group mask group that contains the mask of surface
+    /// @param index mask index of surface
+    /// @param trk_state track state of the surface
+    /// @param bound_params bound parameter
+    /// @param chi2_max the largest accepted chi-square
+    ///
+    template <typename mask_group_t, typename index_t>
+    TRACCC_HOST_DEVICE inline void operator()(
+        const mask_group_t& /*mask_group*/, const index_t& /*index*/,
+        track_state<algebra_t>& trk_state, bound_track_parameters& bound_params,
+        const scalar_type chi2_max) const {
+
+        using shape_type = typename mask_group_t::value_type::shape;
+
+        const auto D = trk_state.get_measurement().meas_dim;
+        assert(D == 1u || D == 2u);
+        if (D == 1u) {
+            gated_update<1u, shape_type>(trk_state, bound_params, chi2_max);
+        } else if (D == 2u) {
+            gated_update<2u, shape_type>(trk_state, bound_params, chi2_max);
+        }
+    }
+
+    /// Kalman update for measurements passing a chi-square cut
+    ///
+    /// @param trk_state track state of the surface
+    /// @param bound_params bound parameter
+    /// @param chi2_max the largest accepted chi-square
+    ///
+    template <size_type D, typename shape_t>
+    TRACCC_HOST_DEVICE inline void gated_update(
+        track_state<algebra_t>& trk_state, bound_track_parameters& bound_params,
+        const scalar_type chi2_max) const {
+
+        const scalar_type chi2 =
+            predicted_chi2<D, shape_t>(trk_state, bound_params);
+        if (chi2 < chi2_max) {
+            update<D, shape_t>(trk_state, bound_params);
+        } else {
+            trk_state.filtered_chi2() = chi2;
+        }
+    }
+
+    /// Chi-square of a measurement with respect to the predicted parameters
+    ///
+    /// Calculated as <tt>r^T * (H * P * H^T + V)^-1 * r</tt>, with @c r the
+    /// residual of the measurement and the predicted parameters. This is
+    /// mathematically identical to the chi-square of the filtered parameters,
+    /// but does not need the Kalman gain or the filtered covariance.
+    ///
+    /// @param trk_state track state of the surface
+    /// @param bound_params predicted bound parameter
+    ///
+    /// @return the predicted chi-square
+    ///
+    template <size_type D, typename shape_t>
+    TRACCC_HOST_DEVICE inline scalar_type predicted_chi2(
+        const track_state<algebra_t>& trk_state,
+        const bound_track_parameters& bound_params) const {
+
+        static_assert(((D == 1u) || (D == 2u)),
+                      "The measurement dimension should be 1 or 2");
+
+        const auto meas = trk_state.get_measurement();
+        const auto& axes = meas.subs.get_indices();
+
+        // Predicted vector and covariance of bound track parameters
+        const matrix_type<e_bound_size, 1>& predicted_vec =
+            bound_params.vector();
+        const matrix_type<e_bound_size, e_bound_size>& predicted_cov =
+            bound_params.covariance();
+
+        // Measurement data and spatial resolution on surface
+        const matrix_type<D, 1> meas_local =
+            trk_state.template measurement_local<D>();
+        const matrix_type<D, D> V =
+            trk_state.template measurement_covariance<D>();
+
+        // Predicted residual, and H * P * H^T + V
+        matrix_type<D, 1> residual;
+        matrix_type<D, D> M;
+        scalar_type sign[D];
+        if (projection_signs<D, shape_t>(axes, predicted_vec, sign)) {
+            for (size_type i = 0u; i < D; ++i) {
+                getter::element(residual, i, 0u) =
+                    getter::element(meas_local, i, 0u) -
+                    sign[i] * getter::element(predicted_vec, axes[i], 0u);
+                for (size_type j = 0u; j < D; ++j) {
+                    getter::element(M, i, j) =
+                        sign[i] * sign[j] *
+                            getter::element(predicted_cov, axes[i], axes[j]) +
+                        getter::element(V, i, j);
+                }
+            }
+        } else {
+            matrix_type<D, e_bound_size> H = meas.subs.template projector<D>();
+            getter::element(H, 0u, e_bound_loc0) = -1;
+            residual = meas_local - H * predicted_vec;
+            M = H * predicted_cov * matrix_operator().transpose(H) + V;
+        }
+
+        const matrix_type<D, D> M_inv = invert<D>(M);
+        scalar_type chi2 = 0.f;
+        for (size_type i = 0u; i < D; ++i) {
+            for (size_type j = 0u; j < D; ++j) {
+                chi2 += getter::element(residual, i, 0u) *
+                        getter::element(M_inv, i, j) *
+                        getter::element(residual, j, 0u);
+            }
+        }
+        return chi2;
+    }
+
+    /// Kalman update for a measurement of a given dimension
+    ///
+    /// Uses @c update_projected by default, and @c update_generic if
+    /// @c TRACCC_GENERIC_KALMAN_UPDATE is defined.
+    ///
+    /// @param trk_state track state of the surface
+    /// @param bound_params bound parameter
+    ///
     template <size_type D, typename shape_t>
     TRACCC_HOST_DEVICE inline void update(
         track_state<algebra_t>& trk_state,
         bound_track_parameters& bound_params) const {
 
+#ifdef TRACCC_GENERIC_KALMAN_UPDATE
+        update_generic<D, shape_t>(trk_state, bound_params);
+#else
+        update_projected<D, shape_t>(trk_state, bound_params);
+#endif
+    }
+
+    /// Kalman update using generic matrix operations
+    ///
+    /// @param trk_state track state of the surface
+    /// @param bound_params bound parameter
+    ///
+    template <size_type D, typename shape_t>
+    TRACCC_HOST_DEVICE inline void update_generic(
+        track_state<algebra_t>& trk_state,
+        bound_track_parameters& bound_params) const {
+
         static_assert(((D == 1u) || (D == 2u)),
                       "The measurement dimension should be 1 or 2");
 
@@ -132,6 +278,202 @@ struct gain_matrix_updater {
 
         return;
     }
+
+    /// Kalman update exploiting the structure of the projection matrix
+    ///
+    /// The projection matrix of a measurement only selects @c D of the bound
+    /// parameters (flipping the sign of loc0 on line surfaces, when needed).
+    /// So all products with it are replaced by picking out elements of the
+    /// predicted parameters, the @c DxD matrices are inverted analytically,
+    /// and only one triangle of the (symmetric) filtered covariance is
+    /// calculated.
+    ///
+    /// @param trk_state track state of the surface
+    /// @param bound_params bound parameter
+    ///
+    template <size_type D, typename shape_t>
+    TRACCC_HOST_DEVICE inline void update_projected(
+        track_state<algebra_t>& trk_state,
+        bound_track_parameters& bound_params) const {
+
+        static_assert(((D == 1u) || (D == 2u)),
+                      "The measurement dimension should be 1 or 2");
+
+        const auto meas = trk_state.get_measurement();
+        const auto& axes = meas.subs.get_indices();
+
+        // Predicted vector of bound track parameters
+        const matrix_type<e_bound_size, 1>& predicted_vec =
+            bound_params.vector();
+
+        // Predicted covaraince of bound track parameters
+        const matrix_type<e_bound_size, e_bound_size>& predicted_cov =
+            bound_params.covariance();
+
+        // Signs of the (non-zero) projection matrix elements
+        scalar_type sign[D];
+        if (!projection_signs<D, shape_t>(axes, predicted_vec, sign)) {
+            update_generic<D, shape_t>(trk_state, bound_params);
+            return;
+        }
+
+        // Set track state parameters
+        trk_state.predicted().set_vector(predicted_vec);
+        trk_state.predicted().set_covariance(predicted_cov);
+
+        // Measurement data on surface
+        const matrix_type<D, 1> meas_local =
+            trk_state.template measurement_local<D>();
+
+        // Spatial resolution (Measurement covariance)
+        const matrix_type<D, D> V =
+            trk_state.template measurement_covariance<D>();
+
+        // P * H^T, the (signed) columns of the measured parameters
+        matrix_type<e_bound_size, D> PHt;
+        for (size_type r = 0u; r < e_bound_size; ++r) {
+            for (size_type i = 0u; i < D; ++i) {
+                getter::element(PHt, r, i) =
+                    sign[i] * getter::element(predicted_cov, r, axes[i]);
+            }
+        }
+
+        // H * P * H^T + V
+        matrix_type<D, D> M;
+        for (size_type i = 0u; i < D; ++i) {
+            for (size_type j = 0u; j < D; ++j) {
+                getter::element(M, i, j) =
+                    sign[i] * getter::element(PHt, axes[i], j) +
+                    getter::element(V, i, j);
+            }
+        }
+
+        // Kalman gain matrix
+        const matrix_type<e_bound_size, D> K = PHt * invert<D>(M);
+
+        // Calculate the filtered track parameters
+        matrix_type<e_bound_size, 1> filtered_vec = predicted_vec;
+        for (size_type i = 0u; i < D; ++i) {
+            const scalar_type predicted_residual =
+                getter::element(meas_local, i, 0u) -
+                sign[i] * getter::element(predicted_vec, axes[i], 0u);
+            for (size_type r = 0u; r < e_bound_size; ++r) {
+                getter::element(filtered_vec, r, 0u) +=
+                    getter::element(K, r, i) * predicted_residual;
+            }
+        }
+
+        // Calculate the filtered covariance, P - K * (H * P), using that
+        // H * P is the transpose of P * H^T.
+        matrix_type<e_bound_size, e_bound_size> filtered_cov;
+        for (size_type r = 0u; r < e_bound_size; ++r) {
+            for (size_type c = r; c < e_bound_size; ++c) {
+                scalar_type value = getter::element(predicted_cov, r, c);
+                for (size_type i = 0u; i < D; ++i) {
+                    value -=
+                        getter::element(K, r, i) * getter::element(PHt, c, i);
+                }
+                getter::element(filtered_cov, r, c) = value;
+                getter::element(filtered_cov, c, r) = value;
+            }
+        }
+
+        // Residual between measurement and (projected) filtered vector
+        matrix_type<D, 1> residual;
+        for (size_type i = 0u; i < D; ++i) {
+            getter::element(residual, i, 0u) =
+                getter::element(meas_local, i, 0u) -
+                sign[i] * getter::element(filtered_vec, axes[i], 0u);
+        }
+
+        // Calculate the chi square, with R = (I - H * K) * V
+        matrix_type<D, D> R;
+        for (size_type i = 0u; i < D; ++i) {
+            for (size_type j = 0u; j < D; ++j) {
+                scalar_type value = getter::element(V, i, j);
+                for (size_type k = 0u; k < D; ++k) {
+                    value -= sign[i] * getter::element(K, axes[i], k) *
+                             getter::element(V, k, j);
+                }
+                getter::element(R, i, j) = value;
+            }
+        }
+        const matrix_type<D, D> R_inv = invert<D>(R);
+        scalar_type chi2 = 0.f;
+        for (size_type i = 0u; i < D; ++i) {
+            for (size_type j = 0u; j < D; ++j) {
+                chi2 += getter::element(residual, i, 0u) *
+                        getter::element(R_inv, i, j) *
+                        getter::element(residual, j, 0u);
+            }
+        }
+
+        // Set the stepper parameter
+        bound_params.set_vector(filtered_vec);
+        bound_params.set_covariance(filtered_cov);
+
+        // Set the track state parameters
+        trk_state.filtered().set_vector(filtered_vec);
+        trk_state.filtered().set_covariance(filtered_cov);
+        trk_state.filtered_chi2() = chi2;
+
+        return;
+    }
+
+    private:
+    /// Get the signs of the (non-zero) projection matrix elements
+    ///
+    /// @param axes the bound parameters selected by the measurement
+    /// @param predicted_vec predicted vector of bound track parameters
+    /// @param sign the signs of the projection matrix elements
+    ///
+    /// @return false if the projection matrix is not a (signed) selection of
+    ///         bound parameters
+    ///
+    template <size_type D, typename shape_t, typename axes_t>
+    TRACCC_HOST_DEVICE static inline bool projection_signs(
+        const axes_t& axes, const matrix_type<e_bound_size, 1>& predicted_vec,
+        scalar_type (&sign)[D]) {
+
+        for (size_type i = 0u; i < D; ++i) {
+            sign[i] = 1.f;
+        }
+        if constexpr (std::is_same_v<shape_t, detray::line<true>> ||
+                      std::is_same_v<shape_t, detray::line<false>>) {
+
+            if (getter::element(predicted_vec, e_bound_loc0, 0u) < 0) {
+                // The projection matrix would not be a simple selection
+                // anymore if the first measured parameter was not loc0.
+                if (axes[0] != e_bound_loc0) {
+                    return false;
+                }
+                sign[0] = -1.f;
+            }
+        }
+        return true;
+    }
+
+    /// Analytic inverse of a 1x1 or 2x2 matrix
+    template <size_type D>
+    TRACCC_HOST_DEVICE static inline matrix_type<D, D> invert(
+        const matrix_type<D, D>& m) {
+
+        matrix_type<D, D> ret;
+        if constexpr (D == 1u) {
+            getter::element(ret, 0u, 0u) = 1.f / getter::element(m, 0u, 0u);
+        } else {
+            const scalar_type inv_det =
+                1.f / (getter::element(m, 0u, 0u) * getter::element(m, 1u, 1u) -
+                       getter::element(m, 0u, 1u) * getter::element(m, 1u, 0u));
+            getter::element(ret, 0u, 0u) = getter::element(m, 1u, 1u) * inv_det;
+            getter::element(ret, 0u, 1u) =
+                -getter::element(m, 0u, 1u) * inv_det;
+            getter::element(ret, 1u, 0u) =
+                -getter::element(m, 1u, 0u) * inv_det;
+            getter::element(ret, 1u, 1u) = getter::element(m, 0u, 0u) * inv_det;
+        }
+        return ret;
+    }
 };
 
 }  // namespace traccc
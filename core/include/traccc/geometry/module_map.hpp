@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <iostream>
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace traccc {
@@ -55,6 +56,26 @@ namespace traccc {
 template <typename K = geometry_id, typename V = transform3>
 class module_map {
     public:
+    /**
+     * @brief The internal representation of nodes in our binary search tree.
+     *
+     * These objects carry three pieces of data. Firstly, there is the starting
+     * ID. Then, there is the size. Since the node represents a stretch of
+     * consecutive IDs, we know that the node ends at `start + size`. Finally,
+     * there is the index in the value array. We keep indices instead of
+     * pointers to make it easier to port this code to other devices.
+     */
+    struct module_map_node {
+        module_map_node() = default;
+
+        module_map_node(K s, std::size_t n, std::size_t i)
+            : start(s), size(n), index(i) {}
+
+        K start = 0;
+        std::size_t size = 0;
+        std::size_t index = 0;
+    };
+
     // Default constructor
     module_map() = default;
 
@@ -130,27 +151,29 @@ class module_map {
 
     bool empty(void) const { return m_nodes.empty(); }
 
-    private:
     /**
-     * @brief The internal representation of nodes in our binary search tree.
+     * @brief Construct a module map from the internal data of another one.
      *
-     * These objects carry three pieces of data. Firstly, there is the starting
-     * ID. Then, there is the size. Since the node represents a stretch of
-     * consecutive IDs, we know that the node ends at `start + size`. Finally,
-     * there is the index in the value array. We keep indices instead of
-     * pointers to make it easier to port this code to other devices.
+     * This allows restoring a map from a serialised copy of it, without
+     * having to re-build its tree.
+     *
+     * @param[in] nodes The nodes of the binary search tree.
+     * @param[in] values The values of the map.
      */
-    struct module_map_node {
-        module_map_node() = default;
+    module_map(std::vector<module_map_node> nodes, std::vector<V> values)
+        : m_nodes(std::move(nodes)), m_values(std::move(values)) {}
 
-        module_map_node(K s, std::size_t n, std::size_t i)
-            : start(s), size(n), index(i) {}
+    /**
+     * @brief Get the nodes of the binary search tree, for serialisation.
+     */
+    const std::vector<module_map_node>& nodes(void) const { return m_nodes; }
 
-        K start = 0;
-        std::size_t size = 0;
-        std::size_t index = 0;
-    };
+    /**
+     * @brief Get the values of the map, for serialisation.
+     */
+    const std::vector<V>& values(void) const { return m_values; }
 
+    private:
     /**
      * @brief Lay out a set of nodes in a binary tree format.
      *
@@ -48,6 +48,34 @@ struct lin_circle {
     const scalar& V() const { return m_V; }
 };
 
+/// Transformed coordinates of a batch of doublets sharing the same middle
+/// spacepoint, in structure-of-arrays layout
+///
+/// @tparam N is the maximal number of doublets in the batch
+///
+template <unsigned int N>
+struct lin_circle_batch {
+    // z origins
+    scalar m_Zo[N];
+    // cotangents of pitch angle
+    scalar m_cotTheta[N];
+    // reciprocals of square of distance between two spacepoints
+    scalar m_iDeltaR[N];
+    // error terms for sp-pairs without correlation of middle space point
+    scalar m_Er[N];
+    // u components in transformed coordinate
+    scalar m_U[N];
+    // v components in transformed coordinate
+    scalar m_V[N];
+
+    /// Get the transformed coordinates of one doublet of the batch
+    TRACCC_HOST_DEVICE
+    lin_circle get(unsigned int i) const {
+        return {m_Zo[i], m_cotTheta[i], m_iDeltaR[i],
+                m_Er[i], m_U[i],        m_V[i]};
+    }
+};
+
 /// Declare all lin_circle collection types
 using lin_circle_collection_types = collection_types<lin_circle>;
 
@@ -0,0 +1,165 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/internal_spacepoint.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/singlet.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <type_traits>
+#include <utility>
+
+namespace traccc {
+
+/// Compact, structure-of-arrays version of @c traccc::sp_grid
+///
+/// All spacepoints of the grid are stored in flat arrays, ordered by bin.
+/// The spacepoints of bin @c i are found at indices
+/// <tt>[bin_offsets[i], bin_offsets[i + 1])</tt>, in the same order as in
+/// the original grid. So an @c sp_location of the original grid refers to
+/// the spacepoint at index <tt>bin_offsets[bin_idx] + sp_idx</tt>.
+///
+struct sp_soa_grid {
+
+    /// @name Type declarations
+    /// @{
+
+    /// Type of the phi axis of the grid
+    using axis_p0_type =
+        std::decay_t<decltype(std::declval<const sp_grid&>().axis_p0())>;
+    /// Type of the z axis of the grid
+    using axis_p1_type =
+        std::decay_t<decltype(std::declval<const sp_grid&>().axis_p1())>;
+    /// Type of the spacepoint links
+    using link_type = internal_spacepoint<spacepoint>::link_type;
+
+    /// @}
+
+    /// Construct the compact grid from a "regular" spacepoint grid
+    ///
+    /// @param g2 The grid to copy the spacepoints from
+    /// @param mr The memory resource to use for the arrays
+    ///
+    sp_soa_grid(const sp_grid& g2, vecmem::memory_resource& mr)
+        : m_axis_p0(g2.axis_p0()),
+          m_axis_p1(g2.axis_p1()),
+          x(&mr),
+          y(&mr),
+          z(&mr),
+          r(&mr),
+          phi(&mr),
+          varR(&mr),
+          varZ(&mr),
+          link(&mr),
+          bin_offsets(g2.nbins() + 1, &mr) {
+
+        // Calculate the bin offsets.
+        bin_offsets[0] = 0;
+        for (unsigned int i = 0; i < g2.nbins(); ++i) {
+            bin_offsets[i + 1] =
+                bin_offsets[i] + static_cast<unsigned int>(g2.bin(i).size());
+        }
+
+        // Copy the spacepoints.
+        const unsigned int n_spacepoints = bin_offsets.back();
+        x.resize(n_spacepoints);
+        y.resize(n_spacepoints);
+        z.resize(n_spacepoints);
+        r.resize(n_spacepoints);
+        phi.resize(n_spacepoints);
+        varR.resize(n_spacepoints);
+        varZ.resize(n_spacepoints);
+        link.resize(n_spacepoints);
+        for (unsigned int i = 0; i < g2.nbins(); ++i) {
+            const auto& bin = g2.bin(i);
+            for (unsigned int j = 0; j < bin.size(); ++j) {
+                const internal_spacepoint<spacepoint>& sp = bin[j];
+                const unsigned int idx = bin_offsets[i] + j;
+                x[idx] = sp.x();
+                y[idx] = sp.y();
+                z[idx] = sp.z();
+                r[idx] = sp.radius();
+                phi[idx] = sp.phi();
+                varR[idx] = sp.varianceR();
+                varZ[idx] = sp.varianceZ();
+                link[idx] = sp.m_link;
+            }
+        }
+    }
+
+    /// Get the phi axis of the grid
+    const axis_p0_type& axis_p0() const { return m_axis_p0; }
+    /// Get the z axis of the grid
+    const axis_p1_type& axis_p1() const { return m_axis_p1; }
+
+    /// Get the number of bins in the grid
+    unsigned int nbins() const {
+        return static_cast<unsigned int>(bin_offsets.size() - 1);
+    }
+    /// Get the global (serialized) index of a bin
+    unsigned int bin_index(unsigned int phi_bin, unsigned int z_bin) const {
+        return phi_bin + z_bin * m_axis_p0.bins();
+    }
+    /// Get the index of the first spacepoint in a bin
+    unsigned int bin_begin(unsigned int bin_idx) const {
+        return bin_offsets[bin_idx];
+    }
+    /// Get the index after the last spacepoint in a bin
+    unsigned int bin_end(unsigned int bin_idx) const {
+        return bin_offsets[bin_idx + 1];
+    }
+    /// Get the flat index of a spacepoint
+    unsigned int index(const sp_location& l) const {
+        return bin_offsets[l.bin_idx] + l.sp_idx;
+    }
+
+    private:
+    /// The phi axis of the grid
+    axis_p0_type m_axis_p0;
+    /// The z axis of the grid
+    axis_p1_type m_axis_p1;
+
+    public:
+    /// @name Spacepoint properties, one element per spacepoint
+    /// @{
+
+    /// x coordinates (relative to the beam position)
+    vecmem::vector<scalar> x;
+    /// y coordinates (relative to the beam position)
+    vecmem::vector<scalar> y;
+    /// z coordinates
+    vecmem::vector<scalar> z;
+    /// Radii
+    vecmem::vector<scalar> r;
+    /// Azimuthal angles
+    vecmem::vector<scalar> phi;
+    /// Variances of the radii
+    vecmem::vector<scalar> varR;
+    /// Variances of the z coordinates
+    vecmem::vector<scalar> varZ;
+    /// Links to the spacepoints in the spacepoint collection
+    vecmem::vector<link_type> link;
+
+    /// @}
+
+    /// Index of the first spacepoint of every bin, plus the total number of
+    /// spacepoints as the last element
+    vecmem::vector<unsigned int> bin_offsets;
+
+};  // struct sp_soa_grid
+
+}  // namespace traccc
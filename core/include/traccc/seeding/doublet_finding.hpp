@@ -11,10 +11,14 @@
 #include "traccc/seeding/detail/doublet.hpp"
 #include "traccc/seeding/detail/singlet.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/seeding/detail/spacepoint_type.hpp"
 #include "traccc/seeding/doublet_finding_helper.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <algorithm>
+
 namespace traccc {
 
 /// Doublet finding to search the combinations of two compatible spacepoints
@@ -97,7 +101,103 @@ struct doublet_finding
         }
     }
 
+    /// Callable operator for doublet finding of a middle spacepoint, using
+    /// the compact (structure-of-arrays) spacepoint grid
+    ///
+    /// The compatibility and the transformed coordinates of the neighbouring
+    /// spacepoints are evaluated in batches, using the batched functions of
+    /// @c traccc::doublet_finding_helper on the flat arrays of the grid. Only the compatible spacepoints are then added to the
+    /// output.
+    ///
+    /// @param grid is the compact spacepoint grid
+    /// @param l is the location of the current middle spacepoint
+    /// @param o is the output (a pair of vectors of doublets and transformed
+    ///          coordinates) to append to
+    ///
+    void operator()(const sp_soa_grid& grid, const sp_location& l,
+                    output_type& o) const {
+        // output
+        auto& doublets = o.first;
+        auto& lin_circles = o.second;
+
+        // middle spacepoint
+        const unsigned int spM_idx = grid.index(l);
+        const scalar xM = grid.x[spM_idx];
+        const scalar yM = grid.y[spM_idx];
+        const scalar zM = grid.z[spM_idx];
+        const scalar rM = grid.r[spM_idx];
+        const scalar varRM = grid.varR[spM_idx];
+        const scalar varZM = grid.varZ[spM_idx];
+
+        auto phi_bins =
+            grid.axis_p0().zone(grid.phi[spM_idx], m_config.neighbor_scope);
+        auto z_bins = grid.axis_p1().zone(zM, m_config.neighbor_scope);
+
+        // Flat arrays of the spacepoint coordinates.
+        const scalar* const x = grid.x.data();
+        const scalar* const y = grid.y.data();
+        const scalar* const z = grid.z.data();
+        const scalar* const r = grid.r.data();
+        const scalar* const varR = grid.varR.data();
+        const scalar* const varZ = grid.varZ.data();
+
+        // iterator over neighbor bins
+        for (auto& phi_bin : phi_bins) {
+            for (auto& z_bin : z_bins) {
+                const unsigned int bin_idx = grid.bin_index(
+                    static_cast<unsigned int>(phi_bin),
+                    static_cast<unsigned int>(z_bin));
+                const unsigned int bin_begin = grid.bin_begin(bin_idx);
+                const unsigned int bin_end = grid.bin_end(bin_idx);
+
+                for (unsigned int batch_begin = bin_begin;
+                     batch_begin < bin_end; batch_begin += batch_size) {
+
+                    const unsigned int n =
+                        std::min(batch_size, bin_end - batch_begin);
+
+                    // Evaluate the compatibility of a batch of spacepoints.
+                    bool compatible[batch_size];
+                    doublet_finding_helper::isCompatible<otherSpType>(
+                        rM, zM, r + batch_begin, z + batch_begin, n, m_config,
+                        compatible);
+
+                    // Collect the indices of the compatible spacepoints.
+                    unsigned int selected[batch_size];
+                    unsigned int n_selected = 0;
+                    for (unsigned int i = 0; i < n; ++i) {
+                        if (compatible[i]) {
+                            selected[n_selected++] = i;
+                        }
+                    }
+                    if (n_selected == 0) {
+                        continue;
+                    }
+
+                    // Transform the coordinates of the compatible spacepoints.
+                    lin_circle_batch<batch_size> lins;
+                    doublet_finding_helper::transform_coordinates<otherSpType>(
+                        xM, yM, zM, rM, varRM, varZM, x + batch_begin,
+                        y + batch_begin, z + batch_begin, varR + batch_begin,
+                        varZ + batch_begin, selected, n_selected, lins);
+
+                    // Create the doublets from the compatible spacepoints.
+                    for (unsigned int k = 0; k < n_selected; ++k) {
+                        const unsigned int sp_idx =
+                            batch_begin + selected[k] - bin_begin;
+                        doublets.push_back(
+                            doublet({l, sp_location{bin_idx, sp_idx}}));
+                        lin_circles.push_back(lins.get(k));
+                    }
+                }
+            }
+        }
+    }
+
     private:
+    /// Number of spacepoints to evaluate the compatibility of in one go
+    static constexpr unsigned int batch_size = 64u;
+
     seedfinder_config m_config;
 };
 
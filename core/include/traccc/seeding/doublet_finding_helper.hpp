@@ -46,6 +46,89 @@ struct doublet_finding_helper {
     static inline TRACCC_HOST_DEVICE lin_circle
     transform_coordinates(const internal_spacepoint<spacepoint>& sp1,
                           const internal_spacepoint<spacepoint>& sp2);
+
+    /// Check if two spacepoints form doublets, based on their coordinates
+    ///
+    /// This version evaluates all conditions without short-circuiting, for
+    /// use in the batched loops over structure-of-arrays spacepoint data.
+    ///
+    /// @param rM is the radius of the middle spacepoint
+    /// @param zM is the z coordinate of the middle spacepoint
+    /// @param rO is the radius of the bottom or top spacepoint
+    /// @param zO is the z coordinate of the bottom or top spacepoint
+    /// @param config is configuration parameter
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    /// @return boolean value for compatibility
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST_DEVICE bool isCompatible(
+        scalar rM, scalar zM, scalar rO, scalar zO,
+        const seedfinder_config& config);
+
+    /// Do the conformal transformation on doublet's coordinate, based on the
+    /// coordinates of the spacepoints
+    ///
+    /// @param xM, yM, zM, rM are the coordinates of the middle spacepoint
+    /// @param varRM, varZM are the variances of the middle spacepoint
+    /// @param xO, yO, zO are the coordinates of the bottom or top spacepoint
+    /// @param varRO, varZO are the variances of the bottom or top spacepoint
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    /// @reutrn lin_circle which contains the transformed coordinate information
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST_DEVICE lin_circle transform_coordinates(
+        scalar xM, scalar yM, scalar zM, scalar rM, scalar varRM,
+        scalar varZM, scalar xO, scalar yO, scalar zO, scalar varRO,
+        scalar varZO);
+
+    /// Check if a batch of spacepoints form doublets with a middle spacepoint
+    ///
+    /// Evaluates the same conditions as the scalar version, for @c n
+    /// candidates stored in structure-of-arrays layout. This is a batched
+    /// interface over a plain loop, it is not explicitly vectorised.
+    ///
+    /// @param rM is the radius of the middle spacepoint
+    /// @param zM is the z coordinate of the middle spacepoint
+    /// @param rO are the radii of the bottom or top spacepoints
+    /// @param zO are the z coordinates of the bottom or top spacepoints
+    /// @param n is the number of spacepoints in the batch
+    /// @param config is configuration parameter
+    /// @param compatible is the output compatibility mask (of size @c n)
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    template <details::spacepoint_type otherSpType>
+    static inline TRACCC_HOST_DEVICE void isCompatible(
+        scalar rM, scalar zM, const scalar* rO, const scalar* zO,
+        unsigned int n, const seedfinder_config& config, bool* compatible);
+
+    /// Do the conformal transformation on a batch of doublets with a common
+    /// middle spacepoint
+    ///
+    /// Only the spacepoints listed in @c indices are transformed, so that the
+    /// candidates rejected by @c isCompatible do not need to be processed.
+    /// This is a batched interface over a plain (gathering) loop, it is not
+    /// vectorised.
+    ///
+    /// @param xM, yM, zM, rM are the coordinates of the middle spacepoint
+    /// @param varRM, varZM are the variances of the middle spacepoint
+    /// @param xO, yO, zO are the coordinates of the bottom or top spacepoints
+    /// @param varRO, varZO are the variances of the bottom or top spacepoints
+    /// @param indices are the indices of the spacepoints to transform
+    /// @param n is the number of indices (at most @c N)
+    /// @param lin_circles is the output of the transformed coordinates, with
+    ///        element @c i belonging to spacepoint @c indices[i]
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    /// doublet
+    ///
+    template <details::spacepoint_type otherSpType, unsigned int N>
+    static inline TRACCC_HOST_DEVICE void transform_coordinates(
+        scalar xM, scalar yM, scalar zM, scalar rM, scalar varRM,
+        scalar varZM, const scalar* xO, const scalar* yO, const scalar* zO,
+        const scalar* varRO, const scalar* varZO, const unsigned int* indices,
+        unsigned int n, lin_circle_batch<N>& lin_circles);
 };
 
 template <details::spacepoint_type otherSpType>
@@ -54,37 +137,38 @@ doublet_finding_helper::isCompatible(const internal_spacepoint<spacepoint>& sp1,
                                      const internal_spacepoint<spacepoint>& sp2,
                                      const seedfinder_config& config) {
 
+    return isCompatible<otherSpType>(sp1.radius(), sp1.z(), sp2.radius(),
+                                     sp2.z(), config);
+}
+
+template <details::spacepoint_type otherSpType>
+bool TRACCC_HOST_DEVICE doublet_finding_helper::isCompatible(
+    scalar rM, scalar zM, scalar rO, scalar zO,
+    const seedfinder_config& config) {
+
     static_assert(otherSpType == details::spacepoint_type::bottom ||
                   otherSpType == details::spacepoint_type::top);
 
+    // check if R distance is too small, because bins are not R-sorted
+    scalar deltaR;
+    // actually cotTheta * deltaR to avoid division by 0 statements
+    scalar cotTheta;
     if constexpr (otherSpType == details::spacepoint_type::bottom) {
-        // check if R distance is too small, because bins are not R-sorted
-        scalar deltaR = sp1.radius() - sp2.radius();
-        // actually cotTheta * deltaR to avoid division by 0 statements
-        scalar cotTheta = sp1.z() - sp2.z();
-        // actually zOrigin * deltaR to avoid division by 0 statements
-        scalar zOrigin = sp1.z() * deltaR - sp1.radius() * cotTheta;
-        if (deltaR > config.deltaRMax || deltaR < config.deltaRMin ||
-            math::fabs(cotTheta) > config.cotThetaMax * deltaR ||
-            zOrigin < config.collisionRegionMin * deltaR ||
-            zOrigin > config.collisionRegionMax * deltaR) {
-            return false;
-        }
+        deltaR = rM - rO;
+        cotTheta = zM - zO;
     } else {
-        // check if R distance is too small, because bins are not R-sorted
-        scalar deltaR = sp2.radius() - sp1.radius();
-        // actually cotTheta * deltaR to avoid division by 0 statements
-        scalar cotTheta = (sp2.z() - sp1.z());
-        // actually zOrigin * deltaR to avoid division by 0 statements
-        scalar zOrigin = sp1.z() * deltaR - sp1.radius() * cotTheta;
-        if (deltaR > config.deltaRMax || deltaR < config.deltaRMin ||
-            math::fabs(cotTheta) > config.cotThetaMax * deltaR ||
-            zOrigin < config.collisionRegionMin * deltaR ||
-            zOrigin > config.collisionRegionMax * deltaR) {
-            return false;
-        }
+        deltaR = rO - rM;
+        cotTheta = zO - zM;
     }
-    return true;
+    // actually zOrigin * deltaR to avoid division by 0 statements
+    const scalar zOrigin = zM * deltaR - rM * cotTheta;
+
+    // Combine the conditions without short-circuiting, so that the batched
+    // loops over this function do not branch on the individual conditions.
+    return !((deltaR > config.deltaRMax) | (deltaR < config.deltaRMin) |
+             (math::fabs(cotTheta) > config.cotThetaMax * deltaR) |
+             (zOrigin < config.collisionRegionMin * deltaR) |
+             (zOrigin > config.collisionRegionMax * deltaR));
 }
 
 template <details::spacepoint_type otherSpType>
@@ -92,21 +176,26 @@ lin_circle TRACCC_HOST_DEVICE doublet_finding_helper::transform_coordinates(
     const internal_spacepoint<spacepoint>& sp1,
     const internal_spacepoint<spacepoint>& sp2) {
 
+    return transform_coordinates<otherSpType>(
+        sp1.x(), sp1.y(), sp1.z(), sp1.radius(), sp1.varianceR(),
+        sp1.varianceZ(), sp2.x(), sp2.y(), sp2.z(), sp2.varianceR(),
+        sp2.varianceZ());
+}
+
+template <details::spacepoint_type otherSpType>
+lin_circle TRACCC_HOST_DEVICE doublet_finding_helper::transform_coordinates(
+    scalar xM, scalar yM, scalar zM, scalar rM, scalar varRM, scalar varZM,
+    scalar xO, scalar yO, scalar zO, scalar varRO, scalar varZO) {
+
     static_assert(otherSpType == details::spacepoint_type::bottom ||
                   otherSpType == details::spacepoint_type::top);
 
-    const scalar& xM = sp1.x();
-    const scalar& yM = sp1.y();
-    const scalar& zM = sp1.z();
-    const scalar& rM = sp1.radius();
-    const scalar& varianceZM = sp1.varianceZ();
-    const scalar& varianceRM = sp1.varianceR();
     scalar cosPhiM = xM / rM;
     scalar sinPhiM = yM / rM;
 
-    scalar deltaX = sp2.x() - xM;
-    scalar deltaY = sp2.y() - yM;
-    scalar deltaZ = sp2.z() - zM;
+    scalar deltaX = xO - xM;
+    scalar deltaY = yO - yM;
+    scalar deltaZ = zO - zM;
     // calculate projection fraction of spM->sp vector pointing in same
     // direction as
     // vector origin->spM (x) and projection fraction of spM->sp vector pointing
@@ -137,11 +226,41 @@ lin_circle TRACCC_HOST_DEVICE doublet_finding_helper::transform_coordinates(
     l.m_U = x * iDeltaR2;
     l.m_V = y * iDeltaR2;
     // error term for sp-pair without correlation of middle space point
-    l.m_Er = ((varianceZM + sp2.varianceZ()) +
-              (cot_theta * cot_theta) * (varianceRM + sp2.varianceR())) *
+    l.m_Er = ((varZM + varZO) + (cot_theta * cot_theta) * (varRM + varRO)) *
              iDeltaR2;
 
     return l;
 }
 
+template <details::spacepoint_type otherSpType>
+void TRACCC_HOST_DEVICE doublet_finding_helper::isCompatible(
+    scalar rM, scalar zM, const scalar* rO, const scalar* zO, unsigned int n,
+    const seedfinder_config& config, bool* compatible) {
+
+    for (unsigned int i = 0; i < n; ++i) {
+        compatible[i] = isCompatible<otherSpType>(rM, zM, rO[i], zO[i], config);
+    }
+}
+
+template <details::spacepoint_type otherSpType, unsigned int N>
+void TRACCC_HOST_DEVICE doublet_finding_helper::transform_coordinates(
+    scalar xM, scalar yM, scalar zM, scalar rM, scalar varRM, scalar varZM,
+    const scalar* xO, const scalar* yO, const scalar* zO, const scalar* varRO,
+    const scalar* varZO, const unsigned int* indices, unsigned int n,
+    lin_circle_batch<N>& lin_circles) {
+
+    for (unsigned int i = 0; i < n; ++i) {
+        const unsigned int j = indices[i];
+        const lin_circle l = transform_coordinates<otherSpType>(
+            xM, yM, zM, rM, varRM, varZM, xO[j], yO[j], zO[j], varRO[j],
+            varZO[j]);
+        lin_circles.m_Zo[i] = l.m_Zo;
+        lin_circles.m_cotTheta[i] = l.m_cotTheta;
+        lin_circles.m_iDeltaR[i] = l.m_iDeltaR;
+        lin_circles.m_Er[i] = l.m_Er;
+        lin_circles.m_U[i] = l.m_U;
+        lin_circles.m_V[i] = l.m_V;
+    }
+}
+
 }  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -36,7 +36,24 @@ class seed_filtering {
                     const sp_grid& g2, triplet_collection_types::host& triplets,
                     seed_collection_types::host& seeds) const;
 
+    /// Callable operator for the seed filtering of slim spacepoints
+    ///
+    /// @param sp_collection is the (slim) spacepoint collection
+    /// @param triplets is the vector of triplets per middle spacepoint
+    ///
+    /// @return seeds are the vector of seeds where the new compatible seeds are
+    /// added
+    void operator()(const slim_spacepoint_collection_types::host& sp_collection,
+                    const sp_grid& g2, triplet_collection_types::host& triplets,
+                    seed_collection_types::host& seeds) const;
+
     private:
+    /// Implementation of the seed filtering, for any spacepoint type
+    template <typename spacepoint_collection_t>
+    void filter(const spacepoint_collection_t& sp_collection,
+                const sp_grid& g2, triplet_collection_types::host& triplets,
+                seed_collection_types::host& seeds) const;
+
     /// Seed filter configuration
     seedfilter_config m_filter_config;
 
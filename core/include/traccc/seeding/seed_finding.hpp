@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,7 @@
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/seeding/doublet_finding.hpp"
 #include "traccc/seeding/seed_filtering.hpp"
 #include "traccc/seeding/triplet_finding.hpp"
@@ -22,28 +23,82 @@ namespace traccc {
 /// Seed finding
 class seed_finding
     : public algorithm<seed_collection_types::host(
-          const spacepoint_collection_types::host&, const sp_grid&)> {
+          const spacepoint_collection_types::host&, const sp_grid&,
+          const sp_soa_grid&)> {
 
     public:
     /// Constructor for the seed finding
     ///
     /// @param find_config is seed finder configuration parameters
     /// @param filter_config is the seed filter configuration
+    /// @param parallel whether to process the bins of the spacepoint grid
+    ///                 concurrently (using TBB)
     ///
     seed_finding(const seedfinder_config& find_config,
-                 const seedfilter_config& filter_config);
+                 const seedfilter_config& filter_config,
+                 bool parallel = false);
 
     /// Callable operator for the seed finding
     ///
+    /// The grids are meant to be made by
+    /// @c traccc::spacepoint_binning::make_grids.
+    ///
     /// @param sp_collection All spacepoints in the event
     /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param soa_grid Compact copy of @c g2
     /// @return seed_collection is the vector of seeds per event
     ///
     output_type operator()(
         const spacepoint_collection_types::host& sp_collection,
-        const sp_grid& g2) const override;
+        const sp_grid& g2, const sp_soa_grid& soa_grid) const override;
+
+    /// Callable operator for the seed finding on slim spacepoints, with a
+    /// pre-made compact grid
+    ///
+    /// @param sp_collection All (slim) spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param soa_grid Compact copy of @c g2
+    /// @return seed_collection is the vector of seeds per event
+    ///
+    output_type operator()(
+        const slim_spacepoint_collection_types::host& sp_collection,
+        const sp_grid& g2, const sp_soa_grid& soa_grid) const;
 
     private:
+    /// Scratch buffers re-used between the middle spacepoints
+    struct scratch_buffers {
+        /// Middle-bottom doublets of the current middle spacepoint
+        doublet_finding<details::spacepoint_type::bottom>::output_type mid_bot;
+        /// Middle-top doublets of the current middle spacepoint
+        doublet_finding<details::spacepoint_type::top>::output_type mid_top;
+        /// Triplets of the current middle-bottom doublet
+        triplet_finding::output_type triplets;
+        /// Triplets of the current middle spacepoint
+        triplet_finding::output_type triplets_per_spM;
+        /// Scratch memory of the triplet finding
+        triplet_finding::scratch_type triplet_scratch;
+    };
+
+    /// Implementation of the seed finding, for any spacepoint type
+    template <typename spacepoint_collection_t>
+    output_type find(const spacepoint_collection_t& sp_collection,
+                     const sp_grid& g2, const sp_soa_grid& soa_grid) const;
+
+    /// Find the seeds with their middle spacepoint in one bin of the grid
+    ///
+    /// @param sp_collection All spacepoints in the event
+    /// @param g2 The same spacepoints arranged in a 2D Phi-Z grid
+    /// @param soa_grid Compact copy of @c g2, used in the doublet finding
+    /// @param bin_idx The index of the bin to process
+    /// @param scratch The scratch buffers to use
+    /// @param seeds The collection to append the seeds to
+    ///
+    template <typename spacepoint_collection_t>
+    void find_seeds(const spacepoint_collection_t& sp_collection,
+                    const sp_grid& g2, const sp_soa_grid& soa_grid,
+                    unsigned int bin_idx, scratch_buffers& scratch,
+                    seed_collection_types::host& seeds) const;
+
     /// Algorithm performing the mid bottom doublet finding
     doublet_finding<details::spacepoint_type::bottom> m_midBot_finding;
     /// Algorithm performing the mid top doublet finding
@@ -52,6 +107,8 @@ class seed_finding
     triplet_finding m_triplet_finding;
     /// Algorithm performing the seed selection
     seed_filtering m_seed_filtering;
+    /// Whether to process the bins of the grid concurrently
+    bool m_parallel;
 
 };  // class seed_finding
 
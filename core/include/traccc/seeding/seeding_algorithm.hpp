@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -41,6 +41,14 @@ class seeding_algorithm : public algorithm<seed_collection_types::host(
     output_type operator()(
         const spacepoint_collection_types::host& spacepoints) const override;
 
+    /// Operator executing the algorithm on slim spacepoints.
+    ///
+    /// @param spacepoints All (slim) spacepoints in the event
+    /// @return The track seeds reconstructed from the spacepoints
+    ///
+    output_type operator()(
+        const slim_spacepoint_collection_types::host& spacepoints) const;
+
     private:
     /// Sub-algorithm performing the spacepoint binning
     spacepoint_binning m_spacepoint_binning;
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,7 @@
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // System include(s).
@@ -23,6 +24,14 @@ class spacepoint_binning
     : public algorithm<sp_grid(const spacepoint_collection_types::host&)> {
 
     public:
+    /// The spacepoint grid, together with its compact copy
+    struct grids_type {
+        /// The spacepoints arranged in a Phi-Z grid
+        sp_grid grid;
+        /// Compact (structure-of-arrays) copy of @c grid
+        sp_soa_grid soa_grid;
+    };
+
     /// Constructor for the spacepoint binning
     ///
     /// @param config is seed finder configuration parameters
@@ -41,7 +50,39 @@ class spacepoint_binning
     output_type operator()(
         const spacepoint_collection_types::host& sp_collection) const override;
 
+    /// Operator executing the algorithm on slim spacepoints
+    ///
+    /// @param sp_collection All of the (slim) spacepoints of the event
+    /// @return The spacepoints arranged in a Phi-Z grid
+    ///
+    output_type operator()(
+        const slim_spacepoint_collection_types::host& sp_collection) const;
+
+    /// Bin the spacepoints into both a regular and a compact grid
+    ///
+    /// The compact grid is allocated using the memory resource of the
+    /// algorithm, and is meant to be passed to @c traccc::seed_finding
+    /// together with the regular grid.
+    ///
+    /// @param sp_collection All of the spacepoints of the event
+    /// @return The spacepoints arranged in the two Phi-Z grids
+    ///
+    grids_type make_grids(
+        const spacepoint_collection_types::host& sp_collection) const;
+
+    /// Bin slim spacepoints into both a regular and a compact grid
+    ///
+    /// @param sp_collection All of the (slim) spacepoints of the event
+    /// @return The spacepoints arranged in the two Phi-Z grids
+    ///
+    grids_type make_grids(
+        const slim_spacepoint_collection_types::host& sp_collection) const;
+
     private:
+    /// Implementation of the binning, for any spacepoint type
+    template <typename spacepoint_collection_t>
+    output_type bin(const spacepoint_collection_t& sp_collection) const;
+
     seedfinder_config m_config;
     spacepoint_grid_config m_grid_config;
     std::pair<output_type::axis_p0_type, output_type::axis_p1_type> m_axes;
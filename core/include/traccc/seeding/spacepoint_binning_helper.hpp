@@ -107,8 +107,9 @@ inline std::pair<detray::axis2::circular<>, detray::axis2::regular<>> get_axes(
     return {m_phi_axis, m_z_axis};
 }
 
+template <typename spacepoint_t>
 inline TRACCC_HOST_DEVICE size_t is_valid_sp(const seedfinder_config& config,
-                                             const spacepoint& sp) {
+                                             const spacepoint_t& sp) {
     if (sp.z() > config.zMax || sp.z() < config.zMin) {
         return detray::detail::invalid_value<size_t>();
     }
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 
 // Library include(s).
 #include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/edm/track_parameters.hpp"
@@ -58,6 +59,28 @@ class track_params_estimation
             0.01 / detray::unit<traccc::scalar>::GeV,
             1 * detray::unit<traccc::scalar>::ns}) const override;
 
+    /// Callable operator for track_params_esitmation on slim spacepoints
+    ///
+    /// @param spacepoints All (slim) spacepoints of the event
+    /// @param measurements The measurements that the spacepoints refer to
+    /// @param seeds The reconstructed track seeds of the event
+    /// @param bfield (Temporary) Magnetic field vector
+    /// @param stddev standard deviation for setting the covariance (Default
+    /// value from arXiv:2112.09470v1)
+    /// @return A vector of bound track parameters
+    ///
+    output_type operator()(
+        const slim_spacepoint_collection_types::host& spacepoints,
+        const measurement_collection_types::host& measurements,
+        const seed_collection_types::host& seeds, const vector3& bfield,
+        const std::array<traccc::scalar, traccc::e_bound_size>& stddev = {
+            0.02 * detray::unit<traccc::scalar>::mm,
+            0.03 * detray::unit<traccc::scalar>::mm,
+            1. * detray::unit<traccc::scalar>::degree,
+            1. * detray::unit<traccc::scalar>::degree,
+            0.01 / detray::unit<traccc::scalar>::GeV,
+            1 * detray::unit<traccc::scalar>::ns}) const;
+
     private:
     /// The memory resource to use in the algorithm
     std::reference_wrapper<vecmem::memory_resource> m_mr;
@@ -9,6 +9,7 @@
 
 // Library include(s).
 #include "traccc/definitions/math.hpp"
+#include "traccc/edm/measurement.hpp"
 #include "traccc/edm/seed.hpp"
 #include "traccc/edm/spacepoint.hpp"
 #include "traccc/edm/track_parameters.hpp"
@@ -32,28 +33,22 @@ inline TRACCC_HOST_DEVICE vector2 uv_transform(const scalar& x,
     return uv;
 }
 
+namespace details {
+
 /// helper functions (for both cpu and gpu) to calculate bound track parameter
-/// at the bottom spacepoint
+/// at the bottom spacepoint, out of the spacepoint positions of a seed
 ///
-/// @param seed is the input seed
+/// @param sp_global_positions are the bottom, middle and top positions
+/// @param meas_for_spB is the measurement of the bottom spacepoint
 /// @param bfield is the magnetic field
 /// @param mass is the mass of particle
-template <typename spacepoint_collection_t>
 inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
-    const spacepoint_collection_t& sp_collection, const seed& seed,
-    const vector3& bfield, const scalar mass) {
+    const darray<vector3, 3>& sp_global_positions,
+    const measurement& meas_for_spB, const vector3& bfield,
+    const scalar mass) {
 
     bound_vector params;
 
-    const auto& spB = sp_collection.at(seed.spB_link);
-    const auto& spM = sp_collection.at(seed.spM_link);
-    const auto& spT = sp_collection.at(seed.spT_link);
-
-    darray<vector3, 3> sp_global_positions;
-    sp_global_positions[0] = spB.global;
-    sp_global_positions[1] = spM.global;
-    sp_global_positions[2] = spT.global;
-
     // Define a new coordinate frame with its origin at the bottom space
     // point, z axis long the magnetic field direction and y axis
     // perpendicular to vector from the bottom to middle space point.
@@ -105,7 +100,6 @@ inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
     getter::element(params, e_bound_theta, 0) = getter::theta(direction);
 
     // The measured loc0 and loc1
-    const auto& meas_for_spB = spB.meas;
     getter::element(params, e_bound_loc0, 0) = meas_for_spB.local[0];
     getter::element(params, e_bound_loc1, 0) = meas_for_spB.local[1];
 
@@ -144,4 +138,47 @@ inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
     return params;
 }
 
+}  // namespace details
+
+/// helper functions (for both cpu and gpu) to calculate bound track parameter
+/// at the bottom spacepoint
+///
+/// @param seed is the input seed
+/// @param bfield is the magnetic field
+/// @param mass is the mass of particle
+template <typename spacepoint_collection_t>
+inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
+    const spacepoint_collection_t& sp_collection, const seed& seed,
+    const vector3& bfield, const scalar mass) {
+
+    const auto& spB = sp_collection.at(seed.spB_link);
+    const auto& spM = sp_collection.at(seed.spM_link);
+    const auto& spT = sp_collection.at(seed.spT_link);
+
+    return details::seed_to_bound_vector({spB.global, spM.global, spT.global},
+                                         spB.meas, bfield, mass);
+}
+
+/// helper functions (for both cpu and gpu) to calculate bound track parameter
+/// at the bottom spacepoint, for seeds made of slim spacepoints
+///
+/// @param measurements is the measurement collection of the spacepoints
+/// @param seed is the input seed
+/// @param bfield is the magnetic field
+/// @param mass is the mass of particle
+template <typename spacepoint_collection_t, typename measurement_collection_t>
+inline TRACCC_HOST_DEVICE bound_vector seed_to_bound_vector(
+    const spacepoint_collection_t& sp_collection,
+    const measurement_collection_t& measurements, const seed& seed,
+    const vector3& bfield, const scalar mass) {
+
+    const auto& spB = sp_collection.at(seed.spB_link);
+    const auto& spM = sp_collection.at(seed.spM_link);
+    const auto& spT = sp_collection.at(seed.spT_link);
+
+    return details::seed_to_bound_vector({spB.global, spM.global, spT.global},
+                                         spB.get_measurement(measurements),
+                                         bfield, mass);
+}
+
 }  // namespace traccc
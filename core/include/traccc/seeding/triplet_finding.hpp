@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,6 +13,13 @@
 #include "traccc/seeding/triplet_finding_helper.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
 namespace traccc {
 
 /// Triplet finding to search the compatible combintations of two doublets which
@@ -27,6 +34,21 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
     /// @param isp_container is the internal spacepoint container
     triplet_finding(const seedfinder_config& config) : m_config(config) {}
 
+    /// Scratch memory used for weighting the triplets
+    struct scratch_type {
+        /// Radii of the top spacepoints of the triplets
+        std::vector<scalar> top_radii;
+        /// Indices of the triplets, sorted by curvature
+        std::vector<unsigned int> sorted;
+        /// Curvatures of the triplets, in the order of @c sorted
+        std::vector<scalar> sorted_curvatures;
+        /// Bitmap of the triplets in the curvature window of a triplet,
+        /// with all bits cleared between the triplets
+        std::vector<std::uint64_t> window_mask;
+        /// Top spacepoint radii of the compatible seeds of a triplet
+        std::vector<scalar> compatibleSeedR;
+    };
+
     /// Callable operator for triplet finding per middle-bottom doublet
     ///
     /// @param mid_bot is the current middle-bottom doublets
@@ -63,6 +85,29 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
         const doublet_collection_types::host& doublets_mid_top,
         const lin_circle_collection_types::host& lin_circles_mid_top,
         output_type& o) const {
+        scratch_type scratch;
+        this->operator()(g2, mid_bot, lb, doublets_mid_top,
+                         lin_circles_mid_top, o, scratch);
+    }
+
+    /// Callable operator for triplet finding per middle-bottom doublet
+    ///
+    /// @param mid_bot is the current middle-bottom doublets
+    /// @param lb is transformed coordinate of mid_bot
+    /// @param doublets_mid_top is the vector of middle-top doublets which share
+    /// same middle spacepoint with current middle-bottom doublet
+    /// @param lin_circles_mid_top is transformed coordinates of
+    /// doublets_mid_top
+    /// @param scratch is scratch memory, re-used between calls
+    ///
+    /// void interface
+    ///
+    /// @return a vector of triplets
+    void operator()(
+        const sp_grid& g2, const doublet& mid_bot, const lin_circle& lb,
+        const doublet_collection_types::host& doublets_mid_top,
+        const lin_circle_collection_types::host& lin_circles_mid_top,
+        output_type& o, scratch_type& scratch) const {
         // output
         auto& triplets = o;
 
@@ -74,96 +119,193 @@ struct triplet_finding : public algorithm<triplet_collection_types::host(
         scalar scatteringInRegion2 = m_config.maxScatteringAngle2 * iSinTheta2;
         scatteringInRegion2 *=
             m_config.sigmaScattering * m_config.sigmaScattering;
-        scalar curvature, impact_parameter;
 
-        for (size_t i = 0; i < doublets_mid_top.size(); ++i) {
-            auto& mid_top = doublets_mid_top[i];
-            auto& lt = lin_circles_mid_top[i];
+        // Evaluate the compatibility of the middle-top doublets in batches.
+        const unsigned int n_mid_top =
+            static_cast<unsigned int>(doublets_mid_top.size());
+        for (unsigned int batch_begin = 0; batch_begin < n_mid_top;
+             batch_begin += batch_size) {
+
+            const unsigned int n =
+                std::min(batch_size, n_mid_top - batch_begin);
 
-            if (!triplet_finding_helper::isCompatible(
-                    spM, lb, lt, m_config, iSinTheta2, scatteringInRegion2,
-                    curvature, impact_parameter)) {
-                continue;
+            bool compatible[batch_size];
+            scalar curvature[batch_size];
+            scalar impact_parameter[batch_size];
+            triplet_finding_helper::isCompatible(
+                spM.radius(), spM.varianceR(), spM.varianceZ(), lb,
+                lin_circles_mid_top.data() + batch_begin, n, m_config,
+                iSinTheta2, scatteringInRegion2, compatible, curvature,
+                impact_parameter);
+
+            for (unsigned int i = 0; i < n; ++i) {
+                if (!compatible[i]) {
+                    continue;
+                }
+
+                triplets.push_back(
+                    {mid_bot.sp2,                            // bottom
+                     mid_bot.sp1,                            // middle
+                     doublets_mid_top[batch_begin + i].sp2,  // top
+                     curvature[i],                           // curvature
+                     -impact_parameter[i] *
+                         m_filter_config.impactWeightFactor,
+                     lb.Zo()});
             }
+        }
 
-            triplets.push_back(
-                {mid_bot.sp2,  // bottom
-                 mid_bot.sp1,  // middle
-                 mid_top.sp2,  // top
-                 curvature,    // curvature
-                 -impact_parameter * m_filter_config.impactWeightFactor,
-                 lb.Zo()});
+        // Weight the triplets by the number of compatible seeds.
+        weight_triplets(g2, triplets, scratch);
+    }
+
+    /// Increase the weight of triplets for every compatible seed
+    ///
+    /// Two triplets are compatible if their curvatures are close, and their
+    /// top spacepoints are far enough from each other in r. The triplets
+    /// are sorted by curvature, so that only the ones in the curvature
+    /// window of each triplet need to be checked. The candidates of the
+    /// window are marked in a bitmap, which is then walked in the original
+    /// order of the triplets. This gives the same result as checking all
+    /// other triplets one by one, and stops as soon as the compatible seed
+    /// limit is reached.
+    ///
+    /// @param g2 is the spacepoint grid
+    /// @param triplets are the triplets to weight
+    /// @param scratch is the scratch memory to use
+    ///
+    void weight_triplets(const sp_grid& g2, output_type& triplets,
+                         scratch_type& scratch) const {
+
+        const unsigned int n_triplets =
+            static_cast<unsigned int>(triplets.size());
+
+        // Radii of the top spacepoints.
+        auto& top_radii = scratch.top_radii;
+        top_radii.resize(n_triplets);
+        for (unsigned int i = 0; i < n_triplets; ++i) {
+            const auto& spT_idx = triplets[i].sp3;
+            top_radii[i] = g2.bin(spT_idx.bin_idx)[spT_idx.sp_idx].radius();
+        }
+
+        // Sort the triplets by curvature.
+        auto& sorted = scratch.sorted;
+        sorted.resize(n_triplets);
+        std::iota(sorted.begin(), sorted.end(), 0u);
+        std::sort(sorted.begin(), sorted.end(),
+                  [&triplets](unsigned int a, unsigned int b) {
+                      return (triplets[a].curvature < triplets[b].curvature) ||
+                             ((triplets[a].curvature ==
+                               triplets[b].curvature) &&
+                              (a < b));
+                  });
+        auto& sorted_curvatures = scratch.sorted_curvatures;
+        sorted_curvatures.resize(n_triplets);
+        for (unsigned int i = 0; i < n_triplets; ++i) {
+            sorted_curvatures[i] = triplets[sorted[i]].curvature;
         }
 
-        for (size_t i = 0; i < triplets.size(); ++i) {
+        auto& window_mask = scratch.window_mask;
+        window_mask.assign((n_triplets + 63u) / 64u, 0u);
+        auto& compatibleSeedR = scratch.compatibleSeedR;
+
+        for (unsigned int i = 0; i < n_triplets; ++i) {
             auto& current_triplet = triplets[i];
-            auto& spT_idx = current_triplet.sp3;
-            auto& current_spT = g2.bin(spT_idx.bin_idx)[spT_idx.sp_idx];
-            const auto& currentTop_r = current_spT.radius();
+            const scalar currentTop_r = top_radii[i];
+
+            // curvature window of the compatible seeds
+            const scalar lowerLimitCurv = current_triplet.curvature -
+                                          m_filter_config.deltaInvHelixDiameter;
+            const scalar upperLimitCurv = current_triplet.curvature +
+                                          m_filter_config.deltaInvHelixDiameter;
+            const auto window_begin =
+                std::lower_bound(sorted_curvatures.begin(),
+                                 sorted_curvatures.end(), lowerLimitCurv);
+            const auto window_end = std::upper_bound(
+                window_begin, sorted_curvatures.end(), upperLimitCurv);
+
+            // Mark the other triplets of the window.
+            unsigned int first_word =
+                static_cast<unsigned int>(window_mask.size());
+            unsigned int last_word = 0u;
+            for (auto it = window_begin; it != window_end; ++it) {
+                const unsigned int j =
+                    sorted[static_cast<std::size_t>(
+                        it - sorted_curvatures.begin())];
+                if (j == i) {
+                    continue;
+                }
+                window_mask[j / 64u] |= (std::uint64_t{1u} << (j % 64u));
+                first_word = std::min(first_word, j / 64u);
+                last_word = std::max(last_word, j / 64u);
+            }
 
             // if two compatible seeds with high distance in r are found,
             // compatible seeds span 5 layers
             // -> very good seed
-            std::vector<scalar> compatibleSeedR;
-            scalar lowerLimitCurv = current_triplet.curvature -
-                                    m_filter_config.deltaInvHelixDiameter;
-            scalar upperLimitCurv = current_triplet.curvature +
-                                    m_filter_config.deltaInvHelixDiameter;
-
-            for (size_t j = 0; j < triplets.size(); ++j) {
-                if (i == j) {
-                    continue;
-                }
+            compatibleSeedR.clear();
+            bool limit_reached = false;
+            for (unsigned int w = first_word; w <= last_word; ++w) {
 
-                auto& other_triplet = triplets[j];
-                auto& other_spT_idx = other_triplet.sp3;
-                auto& other_spT =
-                    g2.bin(other_spT_idx.bin_idx)[other_spT_idx.sp_idx];
+                // Take (and clear) the next word of the bitmap. Once the
+                // compatible seed limit is reached, the remaining words only
+                // need to be cleared.
+                std::uint64_t bits = window_mask[w];
+                window_mask[w] = 0u;
+                for (; (bits != 0u) && (!limit_reached); bits &= bits - 1u) {
+                    const unsigned int j = w * 64u + lowest_set_bit(bits);
 
-                // compared top SP should have at least deltaRMin distance
-                const auto& otherTop_r = other_spT.radius();
-                scalar deltaR = currentTop_r - otherTop_r;
-                if (std::abs(deltaR) < m_filter_config.deltaRMin) {
-                    continue;
-                }
-
-                // curvature difference within limits?
-                // TODO: how much slower than sorting all vectors by curvature
-                // and breaking out of loop? i.e. is vector size large (e.g. in
-                // jets?)
-                if (other_triplet.curvature < lowerLimitCurv) {
-                    continue;
-                }
-                if (other_triplet.curvature > upperLimitCurv) {
-                    continue;
-                }
+                    // compared top SP should have at least deltaRMin distance
+                    const scalar otherTop_r = top_radii[j];
+                    scalar deltaR = currentTop_r - otherTop_r;
+                    if (std::abs(deltaR) < m_filter_config.deltaRMin) {
+                        continue;
+                    }
 
-                bool newCompSeed = true;
-                for (scalar previousDiameter : compatibleSeedR) {
-                    // original ATLAS code uses higher min distance for 2nd
-                    // found compatible seed (20mm instead of 5mm) add new
-                    // compatible seed only if distance larger than rmin to all
-                    // other compatible seeds
-                    if (std::abs(previousDiameter - otherTop_r) <
-                        m_filter_config.deltaRMin) {
-                        newCompSeed = false;
-                        break;
+                    bool newCompSeed = true;
+                    for (scalar previousDiameter : compatibleSeedR) {
+                        // original ATLAS code uses higher min distance for 2nd
+                        // found compatible seed (20mm instead of 5mm) add new
+                        // compatible seed only if distance larger than rmin to
+                        // all other compatible seeds
+                        if (std::abs(previousDiameter - otherTop_r) <
+                            m_filter_config.deltaRMin) {
+                            newCompSeed = false;
+                            break;
+                        }
                     }
-                }
 
-                if (newCompSeed) {
-                    compatibleSeedR.push_back(otherTop_r);
-                    current_triplet.weight += m_filter_config.compatSeedWeight;
-                }
+                    if (newCompSeed) {
+                        compatibleSeedR.push_back(otherTop_r);
+                        current_triplet.weight +=
+                            m_filter_config.compatSeedWeight;
+                    }
 
-                if (compatibleSeedR.size() >= m_filter_config.compatSeedLimit) {
-                    break;
+                    limit_reached = (compatibleSeedR.size() >=
+                                     m_filter_config.compatSeedLimit);
                 }
             }
         }
     }
 
     private:
+    /// Get the index of the lowest set bit of a (non-zero) bitmap word
+    static unsigned int lowest_set_bit(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned int>(__builtin_ctzll(bits));
+#else
+        unsigned int result = 0u;
+        while ((bits & 1u) == 0u) {
+            bits >>= 1u;
+            ++result;
+        }
+        return result;
+#endif
+    }
+
+    /// Number of middle-top doublets to evaluate the compatibility of in one
+    /// go
+    static constexpr unsigned int batch_size = 64u;
+
     seedfinder_config m_config;
     seedfilter_config m_filter_config;
 };
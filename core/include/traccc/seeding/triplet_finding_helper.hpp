@@ -36,6 +36,37 @@ struct triplet_finding_helper {
         const lin_circle& lt, const seedfinder_config& config,
         const scalar& iSinTheta2, const scalar& scatteringInRegion2,
         scalar& curvature, scalar& impact_parameter);
+
+    /// Check if a middle-bottom doublet can form triplets with a batch of
+    /// middle-top doublets
+    ///
+    /// Evaluates the same conditions as the scalar version, without
+    /// branching on the individual conditions. This is a batched interface
+    /// over a plain loop on the middle-top doublets, it is not explicitly
+    /// vectorised. The curvature and impact parameter values are only
+    /// meaningful for the compatible doublets.
+    ///
+    /// @param rM is the radius of the middle spacepoint
+    /// @param varRM is the variance of the radius of the middle spacepoint
+    /// @param varZM is the variance of the z coordinate of the middle
+    /// spacepoint
+    /// @param lb is transformed coordinate of middle-bottom doublet
+    /// @param lt are transformed coordinates of the middle-top doublets
+    /// @param n is the number of middle-top doublets in the batch
+    /// @param config is configuration parameter
+    /// @param iSinTheta2 is the square of sin of pitch angle
+    /// @param scatteringInRegion2 is the threshold for scattering angle for the
+    /// lower pT cut
+    /// @param compatible is the output compatibility mask (of size @c n)
+    /// @param curvature are the curvatures of the triplets (of size @c n)
+    /// @param impact_parameter are the impact parameters of the triplets (of
+    /// size @c n)
+    ///
+    static inline TRACCC_HOST_DEVICE void isCompatible(
+        scalar rM, scalar varRM, scalar varZM, const lin_circle& lb,
+        const lin_circle* lt, unsigned int n, const seedfinder_config& config,
+        scalar iSinTheta2, scalar scatteringInRegion2, bool* compatible,
+        scalar* curvature, scalar* impact_parameter);
 };
 
 bool TRACCC_HOST_DEVICE triplet_finding_helper::isCompatible(
@@ -130,4 +161,64 @@ bool TRACCC_HOST_DEVICE triplet_finding_helper::isCompatible(
     return true;
 }
 
+void TRACCC_HOST_DEVICE triplet_finding_helper::isCompatible(
+    scalar rM, scalar varRM, scalar varZM, const lin_circle& lb,
+    const lin_circle* lt, unsigned int n, const seedfinder_config& config,
+    scalar iSinTheta2, scalar scatteringInRegion2, bool* compatible,
+    scalar* curvature, scalar* impact_parameter) {
+
+    // scattering for p(T) above maxPtScattering
+    const scalar pTscatter = config.highland / config.maxPtScattering;
+    const scalar pT2scatterMax = pTscatter * pTscatter;
+
+    for (unsigned int i = 0; i < n; ++i) {
+
+        // The same arithmetic as in the scalar version, but with all
+        // quantities evaluated unconditionally, and the conditions combined
+        // at the end.
+        const scalar error2 = lt[i].Er() + lb.Er() +
+                              static_cast<scalar>(2.f) *
+                                  (lb.cotTheta() * lt[i].cotTheta() * varRM +
+                                   varZM) *
+                                  lb.iDeltaR() * lt[i].iDeltaR();
+
+        const scalar deltaCotTheta = lb.cotTheta() - lt[i].cotTheta();
+        const scalar deltaCotTheta2 = deltaCotTheta * deltaCotTheta;
+        const bool check_scattering = (deltaCotTheta2 - error2 > 0);
+        const scalar error = std::sqrt(error2);
+        const scalar dCotThetaMinusError2 =
+            deltaCotTheta2 + error2 -
+            static_cast<scalar>(2.) * math::fabs(deltaCotTheta) * error;
+
+        const scalar dU = lt[i].U() - lb.U();
+        const scalar A = (lt[i].V() - lb.V()) / dU;
+        const scalar S2 = static_cast<scalar>(1.) + A * A;
+        const scalar B = lb.V() - A * lb.U();
+        const scalar B2 = B * B;
+
+        const scalar iHelixDiameter2 = B2 / S2;
+        const scalar pT = config.pTPerHelixRadius * std::sqrt(S2 / B2) /
+                          static_cast<scalar>(2.);
+        const scalar pT2scatter =
+            (pT > config.maxPtScattering)
+                ? pT2scatterMax
+                : static_cast<scalar>(4.) * iHelixDiameter2 *
+                      config.pT2perRadius;
+        const scalar p2scatter = pT2scatter * iSinTheta2;
+
+        curvature[i] = B / std::sqrt(S2);
+        impact_parameter[i] = math::fabs((A - B * rM) * rM);
+
+        compatible[i] =
+            !((check_scattering &
+               (dCotThetaMinusError2 > scatteringInRegion2)) |
+              (dU == static_cast<scalar>(0.)) |
+              (S2 < B2 * config.minHelixDiameter2) |
+              (check_scattering &
+               (dCotThetaMinusError2 > p2scatter * config.sigmaScattering *
+                                          config.sigmaScattering)) |
+              (impact_parameter[i] > config.impactMax));
+    }
+}
+
 }  // namespace traccc
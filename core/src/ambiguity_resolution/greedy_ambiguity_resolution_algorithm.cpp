@@ -9,11 +9,16 @@
 
 // System include
 #include <algorithm>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
 #include <map>
+#include <numeric>
+#include <queue>
 #include <set>
+#include <sstream>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -27,6 +32,11 @@
 #include "traccc/edm/track_state.hpp"
 #include "traccc/utils/algorithm.hpp"
 
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
 // Greedy ambiguity resolution adapted from ACTS code
 
 namespace traccc {
@@ -53,6 +63,11 @@ namespace {
         logger::debug() << msg << std::endl; \
     }
 
+#define LOG_DEBUG_TO(out, msg)                  \
+    if (_config.verbose_debug) {                \
+        logger::debug(out) << msg << std::endl; \
+    }
+
 // This logger is specific to the greedy_ambiguity_resolution_algorithm, and to
 // this translation unit.
 struct logger {
@@ -71,9 +86,69 @@ struct logger {
         return std::cout;
     }
 
-    static std::ostream& debug() {
-        std::cout << "DEBUG: @greedy_ambiguity_resolution_algorithm: ";
-        return std::cout;
+    static std::ostream& debug(std::ostream& out = std::cout) {
+        out << "DEBUG: @greedy_ambiguity_resolution_algorithm: ";
+        return out;
+    }
+};
+
+/// Access to the chi2 and the measurement_id-s of fitted tracks
+struct track_state_accessor {
+    const track_state_container_types::host& track_states;
+
+    std::size_t size() const { return track_states.size(); }
+    traccc::scalar chi2(std::size_t track_index) const {
+        return track_states[track_index].header.chi2;
+    }
+    std::size_t n_measurements(std::size_t track_index) const {
+        return track_states[track_index].items.size();
+    }
+    std::size_t measurement_id(std::size_t track_index, std::size_t i) const {
+        return track_states[track_index]
+            .items[i]
+            .get_measurement()
+            .measurement_id;
+    }
+};
+
+/// Access to the chi2 and the measurement_id-s of compact track candidates
+struct compact_track_accessor {
+    const vecmem::vector<fitting_result<default_algebra>>& fit_results;
+    const compact_track_candidate_container_types::host& track_candidates;
+    const measurement_collection_types::host& measurements;
+
+    std::size_t size() const { return track_candidates.size(); }
+    traccc::scalar chi2(std::size_t track_index) const {
+        return fit_results[track_index].chi2;
+    }
+    std::size_t n_measurements(std::size_t track_index) const {
+        return track_candidates[track_index].items.size();
+    }
+    std::size_t measurement_id(std::size_t track_index, std::size_t i) const {
+        return track_candidates[track_index]
+            .items[i]
+            .get_measurement(measurements)
+            .measurement_id;
+    }
+};
+
+/// Access to the chi2 and the measurement_id-s of compact fitted tracks
+struct compact_track_state_accessor {
+    const compact_track_state_container_types::host& track_states;
+    const measurement_collection_types::host& measurements;
+
+    std::size_t size() const { return track_states.size(); }
+    traccc::scalar chi2(std::size_t track_index) const {
+        return track_states[track_index].header.chi2;
+    }
+    std::size_t n_measurements(std::size_t track_index) const {
+        return track_states[track_index].items.size();
+    }
+    std::size_t measurement_id(std::size_t track_index, std::size_t i) const {
+        return track_states[track_index]
+            .items[i]
+            .get_measurement(measurements)
+            .measurement_id;
     }
 };
 
@@ -87,24 +162,29 @@ track_state_container_types::host
 greedy_ambiguity_resolution_algorithm::operator()(
     const typename track_state_container_types::host& track_states) const {
 
+    const track_state_accessor tracks{track_states};
+
     state_t state;
-    compute_initial_state(track_states, state);
+    compute_initial_state(tracks, state);
     resolve(state);
 
     if (_config.check_obvious_errs) {
         LOG_DEBUG("Checking result validity...");
-        check_obvious_errors(track_states, state);
+        check_obvious_errors(tracks, state);
     }
 
     // Copy the tracks to be retained in the return value
 
     track_state_container_types::host res;
-    res.reserve(state.selected_tracks.size());
+    res.reserve(state.n_selected_tracks);
+
+    LOG_DEBUG("state.n_selected_tracks = " << state.n_selected_tracks);
 
-    LOG_DEBUG(
-        "state.selected_tracks.size() = " << state.selected_tracks.size());
+    for (std::size_t index = 0; index < state.number_of_tracks; ++index) {
+        if (!state.selected_tracks[index]) {
+            continue;
+        }
 
-    for (std::size_t index : state.selected_tracks) {
         // track_states is a host_container<fitting_result<default_algebra>,
         // track_state<default_algebra>>
         auto const [sm_headers, sm_items] = track_states.at(index);
@@ -124,9 +204,68 @@ greedy_ambiguity_resolution_algorithm::operator()(
     return res;
 }
 
+compact_track_candidate_container_types::host
+greedy_ambiguity_resolution_algorithm::operator()(
+    const vecmem::vector<fitting_result<default_algebra>>& fit_results,
+    const compact_track_candidate_container_types::host& track_candidates,
+    const measurement_collection_types::host& measurements) const {
+
+    const compact_track_accessor tracks{fit_results, track_candidates,
+                                        measurements};
+
+    state_t state;
+    compute_initial_state(tracks, state);
+    resolve(state);
+
+    if (_config.check_obvious_errs) {
+        LOG_DEBUG("Checking result validity...");
+        check_obvious_errors(tracks, state);
+    }
+
+    // Copy the (compact) candidates of the tracks to be retained
+    compact_track_candidate_container_types::host res;
+    res.reserve(state.n_selected_tracks);
+    for (std::size_t index = 0; index < state.number_of_tracks; ++index) {
+        if (!state.selected_tracks[index]) {
+            continue;
+        }
+        res.push_back(track_candidates[index].header,
+                      track_candidates[index].items);
+    }
+    return res;
+}
+
+compact_track_state_container_types::host
+greedy_ambiguity_resolution_algorithm::operator()(
+    const compact_track_state_container_types::host& track_states,
+    const measurement_collection_types::host& measurements) const {
+
+    const compact_track_state_accessor tracks{track_states, measurements};
+
+    state_t state;
+    compute_initial_state(tracks, state);
+    resolve(state);
+
+    if (_config.check_obvious_errs) {
+        LOG_DEBUG("Checking result validity...");
+        check_obvious_errors(tracks, state);
+    }
+
+    // Copy the (compact) tracks to be retained
+    compact_track_state_container_types::host res;
+    res.reserve(state.n_selected_tracks);
+    for (std::size_t index = 0; index < state.number_of_tracks; ++index) {
+        if (!state.selected_tracks[index]) {
+            continue;
+        }
+        res.push_back(track_states[index].header, track_states[index].items);
+    }
+    return res;
+}
+
+template <typename track_accessor_t>
 void greedy_ambiguity_resolution_algorithm::compute_initial_state(
-    const typename track_state_container_types::host& track_states,
-    state_t& state) const {
+    const track_accessor_t& tracks, state_t& state) const {
 
     // Number of measurements, to display a warning if too many measurements
     // share the identifier 0
@@ -136,17 +275,18 @@ void greedy_ambiguity_resolution_algorithm::compute_initial_state(
     // Displays a warning if (mcount_idzero / mcount_all) > warning_threshold
     float warning_threshold = _config.measurement_id_0_warning_threshold;
 
+    state.measurement_offsets.push_back(0);
+
     // For each track of the input container
-    std::size_t n_track_states = track_states.size();
+    std::size_t n_track_states = tracks.size();
     for (std::size_t track_index = 0; track_index < n_track_states;
          ++track_index) {
 
-        // fit_res is a fitting_result<default_algebra>
-        // states  is a vecmem_vector<track_state<default_algebra>>
-        auto const& [fit_res, states] = track_states.at(track_index);
+        // The number of measurements (track states) of the track
+        const std::size_t n_states = tracks.n_measurements(track_index);
 
         // Kick out tracks that do not fulfill our initial requirements
-        if (states.size() < _config.n_measurements_min) {
+        if (n_states < _config.n_measurements_min) {
             continue;
         }
 
@@ -155,8 +295,8 @@ void greedy_ambiguity_resolution_algorithm::compute_initial_state(
         std::unordered_map<std::size_t, std::size_t> already_added_mes;
         bool duplicated_measurements = false;
 
-        for (auto const& st : states) {
-            std::size_t mid = st.get_measurement().measurement_id;
+        for (std::size_t i = 0; i < n_states; ++i) {
+            std::size_t mid = tracks.measurement_id(track_index, i);
             ++mcount_all;
             if (mid == 0) {
                 ++mcount_idzero;
@@ -193,28 +333,57 @@ void greedy_ambiguity_resolution_algorithm::compute_initial_state(
             }
 
             ss << ". Measurement list:";
-            for (auto const& st : states) {
-                ss << " " << st.get_measurement().measurement_id;
+            for (std::size_t i = 0; i < n_states; ++i) {
+                ss << " " << tracks.measurement_id(track_index, i);
             }
 
             LOG_WARN(ss.str());
         }
 
         // Add this track chi2 value
-        state.track_chi2.push_back(fit_res.chi2);
-        // Add all the (measurement_id)s of this track
-        state.measurements_per_track.push_back(std::move(measurements));
-        // Initially, every track is in the selected_track list. They will later
-        // be removed according to the algorithm.
-        state.selected_tracks.insert(state.number_of_tracks);
+        state.track_chi2.push_back(tracks.chi2(track_index));
+        // Add all the (measurement_id)s of this track. They are replaced by
+        // measurement indices once all tracks are known.
+        state.measurements_per_track.insert(state.measurements_per_track.end(),
+                                            measurements.begin(),
+                                            measurements.end());
+        state.measurement_offsets.push_back(
+            state.measurements_per_track.size());
         ++state.number_of_tracks;
     }
 
+    // Give a dense index to every distinct measurement_id
+    std::vector<std::size_t> measurement_ids = state.measurements_per_track;
+    std::sort(measurement_ids.begin(), measurement_ids.end());
+    measurement_ids.erase(
+        std::unique(measurement_ids.begin(), measurement_ids.end()),
+        measurement_ids.end());
+    for (auto& meas : state.measurements_per_track) {
+        meas = static_cast<std::size_t>(
+            std::lower_bound(measurement_ids.begin(), measurement_ids.end(),
+                             meas) -
+            measurement_ids.begin());
+    }
+    const std::size_t n_measurements = measurement_ids.size();
+
     // Associate each measurement to the tracks sharing it
+    state.track_offsets.assign(n_measurements + 1, 0);
+    for (auto meas_index : state.measurements_per_track) {
+        ++state.track_offsets[meas_index + 1];
+    }
+    std::partial_sum(state.track_offsets.begin(), state.track_offsets.end(),
+                     state.track_offsets.begin());
+
+    state.tracks_per_measurement.resize(state.measurements_per_track.size());
+    state.n_tracks_per_measurement.assign(n_measurements, 0);
     for (std::size_t track_index = 0; track_index < state.number_of_tracks;
          ++track_index) {
-        for (auto meas_id : state.measurements_per_track[track_index]) {
-            state.tracks_per_measurement[meas_id].insert(track_index);
+        for (std::size_t i = state.measurement_offsets[track_index];
+             i < state.measurement_offsets[track_index + 1]; ++i) {
+            const std::size_t meas_index = state.measurements_per_track[i];
+            state.tracks_per_measurement
+                [state.track_offsets[meas_index] +
+                 state.n_tracks_per_measurement[meas_index]++] = track_index;
         }
     }
 
@@ -224,13 +393,20 @@ void greedy_ambiguity_resolution_algorithm::compute_initial_state(
 
     for (std::size_t track_index = 0; track_index < state.number_of_tracks;
          ++track_index) {
-        for (auto meas_index : state.measurements_per_track[track_index]) {
-            if (state.tracks_per_measurement[meas_index].size() > 1) {
+        for (std::size_t i = state.measurement_offsets[track_index];
+             i < state.measurement_offsets[track_index + 1]; ++i) {
+            if (state.n_tracks_per_measurement
+                    [state.measurements_per_track[i]] > 1) {
                 ++state.shared_measurements_per_track[track_index];
             }
         }
     }
 
+    // Initially, every track is selected. They will later be removed
+    // according to the algorithm.
+    state.selected_tracks.assign(state.number_of_tracks, true);
+    state.n_selected_tracks = state.number_of_tracks;
+
     if (mcount_all == 0) {
         LOG_ERROR("No measurements.");
     } else {
@@ -261,29 +437,27 @@ void greedy_ambiguity_resolution_algorithm::compute_initial_state(
 /// - Each removed track should share at least
 /// (_config.maximum_shared_hits) with another initial track.
 ///
-/// @param initial_track_states The input track container, as given to
+/// @param initial_tracks The input tracks, as given to
 /// compute_initial_state.
 /// @param final_state The state object after the resolve method has
 /// been called.
+template <typename track_accessor_t>
 bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
-    const typename track_state_container_types::host& initial_track_states,
-    state_t& final_state) const {
+    const track_accessor_t& initial_tracks, state_t& final_state) const {
 
     // Associates every measurement_id to the number of tracks that shares it
     // (during initial state)
     std::unordered_map<std::size_t, std::size_t> initial_measurement_count;
 
     // Initialize initial_measurement_count
-    for (std::size_t track_index = 0; track_index < initial_track_states.size();
+    for (std::size_t track_index = 0; track_index < initial_tracks.size();
          ++track_index) {
-        // fit_res is a fitting_result<default_algebra>
-        // states  is a vecmem_vector<track_state<default_algebra>>
-        auto const& [fit_res, states] = initial_track_states.at(track_index);
 
         std::set<std::size_t> already_added_mes;
 
-        for (auto const& st : states) {
-            std::size_t meas_id = st.get_measurement().measurement_id;
+        for (std::size_t i = 0; i < initial_tracks.n_measurements(track_index);
+             ++i) {
+            std::size_t meas_id = initial_tracks.measurement_id(track_index, i);
 
             // If the same measurement is found multiple times in a single
             // track: remove duplicates.
@@ -314,22 +488,21 @@ bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
     // Checks that every removed track had at least
     // (_config.maximum_shared_hits) common measurements with other tracks
     // =========================================================================
-    std::size_t n_initial_track_states = initial_track_states.size();
+    std::size_t n_initial_track_states = initial_tracks.size();
     for (std::size_t track_index = 0; track_index < n_initial_track_states;
          ++track_index) {
-        auto const& [fit_res, states] = initial_track_states.at(track_index);
 
-        // Skip this track if it has to be kept (i.e. exists in selected_tracks)
-        if (final_state.selected_tracks.find(track_index) !=
-            final_state.selected_tracks.end()) {
+        // Skip this track if it has to be kept (i.e. is selected)
+        if (final_state.is_selected(track_index)) {
             continue;
         }
 
-        // So if the current track has been removed from selected_tracks:
+        // So if the current track has been removed:
 
         std::size_t shared_hits = 0;
-        for (auto const& st : states) {
-            auto meas_id = st.get_measurement().measurement_id;
+        for (std::size_t i = 0; i < initial_tracks.n_measurements(track_index);
+             ++i) {
+            auto meas_id = initial_tracks.measurement_id(track_index, i);
 
             std::unordered_map<std::size_t, std::size_t>::iterator meas_it =
                 initial_measurement_count.find(meas_id);
@@ -383,13 +556,17 @@ bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
         tracks_per_meas_err;
 
     // Initializes tracks_per_measurements
-    for (std::size_t track_index : final_state.selected_tracks) {
-        auto const& [fit_res, states] = initial_track_states.at(track_index);
+    for (std::size_t track_index = 0;
+         track_index < final_state.number_of_tracks; ++track_index) {
+        if (!final_state.selected_tracks[track_index]) {
+            continue;
+        }
 
         std::set<std::size_t> already_added_mes;
 
-        for (auto const& mes : states) {
-            std::size_t meas_id = mes.get_measurement().measurement_id;
+        for (std::size_t i = 0; i < initial_tracks.n_measurements(track_index);
+             ++i) {
+            std::size_t meas_id = initial_tracks.measurement_id(track_index, i);
 
             // If the same measurement is found multiple times in a single
             // track: remove duplicates.
@@ -425,12 +602,10 @@ bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
             for (std::size_t track_index : tracks_per_mes) {
                 std::stringstream ssm;
                 ssm << "    Track(" << track_index << ")'s measurements:";
-                auto const& [fit_res, states] =
-                    initial_track_states.at(track_index);
 
-                for (auto const& st : states) {
-                    auto meas_id = st.get_measurement().measurement_id;
-                    ssm << " " << meas_id;
+                for (std::size_t i = 0;
+                     i < initial_tracks.n_measurements(track_index); ++i) {
+                    ssm << " " << initial_tracks.measurement_id(track_index, i);
                 }
                 LOG_ERROR(ssm.str());
             }
@@ -449,92 +624,291 @@ bool greedy_ambiguity_resolution_algorithm::check_obvious_errors(
     return (all_removed_tracks_alright && independent_tracks);
 }
 
+
 namespace {
 
+/// Entry of the eviction queue of the resolution
+struct eviction_candidate {
+    /// Relative amount of shared measurements of the track
+    double relative_shared_measurements;
+    /// Chi2 value of the track
+    traccc::scalar chi2;
+    /// Index of the track
+    std::size_t track_index;
+    /// Number of shared measurements of the track when the entry was made
+    std::size_t shared_measurements;
+};
+
+/// Orders the eviction candidates such that the track to evict first is at the
+/// top of the queue. First we compare the relative amount of shared
+/// measurements. If that is indecisive we use the chi2, and finally the lowest
+/// track index wins.
+struct eviction_candidate_comparator {
+    bool operator()(const eviction_candidate& a,
+                    const eviction_candidate& b) const {
+        if (a.relative_shared_measurements != b.relative_shared_measurements) {
+            return a.relative_shared_measurements <
+                   b.relative_shared_measurements;
+        }
+        if (a.chi2 != b.chi2) {
+            return a.chi2 < b.chi2;
+        }
+        return a.track_index > b.track_index;
+    }
+};
+
+/// Priority queue of the tracks to evict
+///
+/// Entries are not updated when the number of shared measurements of a track
+/// changes. Instead a new entry is added, and the outdated ones are skipped
+/// when they reach the top of the queue.
+using eviction_queue =
+    std::priority_queue<eviction_candidate, std::vector<eviction_candidate>,
+                        eviction_candidate_comparator>;
+
+/// Makes an eviction queue entry for the current state of a track
+eviction_candidate make_eviction_candidate(
+    const greedy_ambiguity_resolution_algorithm::state_t& state,
+    std::size_t track_index) {
+
+    return {1.0 * state.shared_measurements_per_track[track_index] /
+                state.n_measurements(track_index),
+            state.track_chi2[track_index], track_index,
+            state.shared_measurements_per_track[track_index]};
+}
+
+/// Tells whether an eviction queue entry describes the current state of a
+/// selected track. The number of shared measurements of a track can only
+/// decrease, so it identifies the latest entry of the track.
+bool is_up_to_date(const greedy_ambiguity_resolution_algorithm::state_t& state,
+                   const eviction_candidate& candidate) {
+
+    return state.selected_tracks[candidate.track_index] &&
+           (candidate.shared_measurements ==
+            state.shared_measurements_per_track[candidate.track_index]);
+}
+
 /// Removes a track from the state which has to be done for multiple properties
 /// because of redundancy.
+///
+/// @param state The state to remove the track from
+/// @param track_index The track to remove
+/// @param maximum_shared_hits The maximum amount of shared hits per track
+/// @param queue The eviction queue, receiving the updated tracks
+/// @param n_ambiguous_tracks The number of selected tracks with too many shared
+///                           hits, updated by the function
 static void remove_track(greedy_ambiguity_resolution_algorithm::state_t& state,
-                         std::size_t track_index) {
-    for (auto meas_index : state.measurements_per_track[track_index]) {
-        state.tracks_per_measurement[meas_index].erase(track_index);
+                         std::size_t track_index,
+                         std::size_t maximum_shared_hits,
+                         eviction_queue& queue,
+                         std::size_t& n_ambiguous_tracks) {
+
+    state.selected_tracks[track_index] = false;
+    if (state.shared_measurements_per_track[track_index] >=
+        maximum_shared_hits) {
+        --n_ambiguous_tracks;
+    }
+
+    for (std::size_t i = state.measurement_offsets[track_index];
+         i < state.measurement_offsets[track_index + 1]; ++i) {
+        const std::size_t meas_index = state.measurements_per_track[i];
+
+        // Nothing changes for the other tracks, unless the measurement is not
+        // shared anymore.
+        if (--state.n_tracks_per_measurement[meas_index] != 1) {
+            continue;
+        }
+
+        // Find the only track still using the measurement
+        for (std::size_t j = state.track_offsets[meas_index];
+             j < state.track_offsets[meas_index + 1]; ++j) {
+            const std::size_t j_track = state.tracks_per_measurement[j];
+            if (!state.selected_tracks[j_track]) {
+                continue;
+            }
 
-        if (state.tracks_per_measurement[meas_index].size() == 1) {
-            auto j_track = *state.tracks_per_measurement[meas_index].begin();
-            --state.shared_measurements_per_track[j_track];
+            std::size_t& shared = state.shared_measurements_per_track[j_track];
+            if (shared == maximum_shared_hits) {
+                --n_ambiguous_tracks;
+            }
+            --shared;
+            queue.push(make_eviction_candidate(state, j_track));
+            break;
         }
     }
-    state.selected_tracks.erase(track_index);
+}
+
+/// Finds the root of a track in a union-find forest, compressing the path to
+/// it along the way
+std::size_t find_root(std::vector<std::size_t>& parents, std::size_t i) {
+    while (parents[i] != i) {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
 }
 }  // namespace
 
 void greedy_ambiguity_resolution_algorithm::resolve(state_t& state) const {
-    /// Compares two tracks based on the number of shared measurements in order
-    /// to decide if we already met the final state.
-    auto shared_measurements_comperator = [&state](std::size_t a,
-                                                   std::size_t b) {
-        return state.shared_measurements_per_track[a] <
-               state.shared_measurements_per_track[b];
-    };
-
-    /// Compares two tracks in order to find the one which should be evicted.
-    /// First we compare the relative amount of shared measurements. If that is
-    /// indecisive we use the chi2.
-    auto track_comperator = [&state](std::size_t a, std::size_t b) {
-        /// Helper to calculate the relative amount of shared measurements.
-        auto relative_shared_measurements = [&state](std::size_t i) {
-            return 1.0 * state.shared_measurements_per_track[i] /
-                   state.measurements_per_track[i].size();
-        };
-
-        if (relative_shared_measurements(a) !=
-            relative_shared_measurements(b)) {
-            return relative_shared_measurements(a) <
-                   relative_shared_measurements(b);
+
+    // Without parallelism, all tracks are resolved together.
+    if (!m_parallel) {
+        std::vector<std::size_t> tracks(state.number_of_tracks);
+        std::iota(tracks.begin(), tracks.end(), 0u);
+        state.n_selected_tracks -= resolve_tracks(
+            state, tracks.data(), tracks.data() + tracks.size(), std::cout);
+        return;
+    }
+
+    // Join the tracks sharing a measurement into the same group.
+    std::vector<std::size_t> parents(state.number_of_tracks);
+    std::iota(parents.begin(), parents.end(), 0u);
+    for (std::size_t meas_index = 0;
+         meas_index < state.n_tracks_per_measurement.size(); ++meas_index) {
+        const std::size_t first_track =
+            state.tracks_per_measurement[state.track_offsets[meas_index]];
+        for (std::size_t j = state.track_offsets[meas_index] + 1;
+             j < state.track_offsets[meas_index + 1]; ++j) {
+            const std::size_t root_a = find_root(parents, first_track);
+            const std::size_t root_b =
+                find_root(parents, state.tracks_per_measurement[j]);
+            if (root_a != root_b) {
+                parents[std::max(root_a, root_b)] = std::min(root_a, root_b);
+            }
         }
-        return state.track_chi2[a] < state.track_chi2[b];
-    };
+    }
 
-    std::size_t iteration_count = 0;
-    for (std::size_t i = 0; i < _config.maximum_iterations; ++i) {
-        // Lazy out if there is nothing to filter on.
-        if (state.selected_tracks.empty()) {
-            LOG_DEBUG("No tracks left - exit loop");
-            break;
+    // Number the groups in the order of their first track, and list the
+    // tracks of every group in ascending order.
+    std::vector<std::size_t> group_of_track(state.number_of_tracks);
+    std::vector<std::size_t> group_offsets(1, 0);
+    for (std::size_t track_index = 0; track_index < state.number_of_tracks;
+         ++track_index) {
+        const std::size_t root = find_root(parents, track_index);
+        if (root == track_index) {
+            group_of_track[track_index] = group_offsets.size() - 1;
+            group_offsets.push_back(0);
+        } else {
+            group_of_track[track_index] = group_of_track[root];
         }
+        ++group_offsets[group_of_track[track_index] + 1];
+    }
+    std::partial_sum(group_offsets.begin(), group_offsets.end(),
+                     group_offsets.begin());
+
+    std::vector<std::size_t> group_tracks(state.number_of_tracks);
+    std::vector<std::size_t> group_sizes(group_offsets.size() - 1, 0);
+    for (std::size_t track_index = 0; track_index < state.number_of_tracks;
+         ++track_index) {
+        const std::size_t group = group_of_track[track_index];
+        group_tracks[group_offsets[group] + group_sizes[group]++] =
+            track_index;
+    }
 
-        // Find the maximum amount of shared measurements per track to decide if
-        // we are done or not.
-        auto maximum_shared_measurements = *std::max_element(
-            state.selected_tracks.begin(), state.selected_tracks.end(),
-            shared_measurements_comperator);
+    const std::size_t n_groups = group_sizes.size();
+    LOG_DEBUG("Resolving " << n_groups << " independent groups of tracks");
+
+    // Resolve the groups concurrently. They touch disjoint parts of the state.
+    // The debug messages of every group are collected separately, and are
+    // only printed once all groups are done, so that they do not interleave.
+    tbb::enumerable_thread_specific<std::size_t> n_removed(0u);
+    std::vector<std::string> group_logs(_config.verbose_debug ? n_groups : 0u);
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0u, n_groups),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+            std::size_t& n_removed_local = n_removed.local();
+            for (std::size_t group = range.begin(); group != range.end();
+                 ++group) {
+                const std::size_t* first =
+                    group_tracks.data() + group_offsets[group];
+                const std::size_t* last =
+                    group_tracks.data() + group_offsets[group + 1];
+                if (_config.verbose_debug) {
+                    std::ostringstream group_log;
+                    n_removed_local +=
+                        resolve_tracks(state, first, last, group_log);
+                    group_logs[group] = group_log.str();
+                } else {
+                    n_removed_local +=
+                        resolve_tracks(state, first, last, std::cout);
+                }
+            }
+        });
+    state.n_selected_tracks -= n_removed.combine(std::plus<std::size_t>());
+    for (const std::string& group_log : group_logs) {
+        std::cout << group_log;
+    }
+}
 
-        LOG_DEBUG(
-            "Current maximum shared measurements "
-            << state
-                   .shared_measurements_per_track[maximum_shared_measurements]);
+std::size_t greedy_ambiguity_resolution_algorithm::resolve_tracks(
+    state_t& state, const std::size_t* first, const std::size_t* last,
+    std::ostream& debug_log) const {
 
-        if (state.shared_measurements_per_track[maximum_shared_measurements] <
+    // Number of selected tracks sharing too many measurements, to decide if we
+    // already met the final state
+    std::size_t n_ambiguous_tracks = 0;
+    for (const std::size_t* it = first; it != last; ++it) {
+        if (state.shared_measurements_per_track[*it] >=
             _config.maximum_shared_hits) {
+            ++n_ambiguous_tracks;
+        }
+    }
+
+    // Lazy out if there is nothing to filter on.
+    if (n_ambiguous_tracks == 0) {
+        return 0u;
+    }
+
+    // Queue of the tracks to evict, initially containing every track
+    std::vector<eviction_candidate> candidates;
+    candidates.reserve(static_cast<std::size_t>(last - first));
+    for (const std::size_t* it = first; it != last; ++it) {
+        candidates.push_back(make_eviction_candidate(state, *it));
+    }
+    eviction_queue queue(eviction_candidate_comparator{},
+                         std::move(candidates));
+
+    std::size_t n_selected_tracks = static_cast<std::size_t>(last - first);
+    std::size_t iteration_count = 0;
+    for (std::size_t i = 0; i < _config.maximum_iterations; ++i) {
+        // Lazy out if there is nothing to filter on.
+        if (n_selected_tracks == 0) {
+            LOG_DEBUG_TO(debug_log, "No tracks left - exit loop");
             break;
         }
 
-        // Find the "worst" track by comparing them to each other
-        auto bad_track =
-            *std::max_element(state.selected_tracks.begin(),
-                              state.selected_tracks.end(), track_comperator);
+        LOG_DEBUG_TO(debug_log,
+                     "Current number of tracks with too many shared "
+                     "measurements "
+                         << n_ambiguous_tracks);
 
-        LOG_DEBUG("Remove track "
-                  << bad_track << " n_meas "
-                  << state.measurements_per_track[bad_track].size()
-                  << " nShared "
-                  << state.shared_measurements_per_track[bad_track] << " chi2 "
-                  << state.track_chi2[bad_track]);
+        if (n_ambiguous_tracks == 0) {
+            break;
+        }
 
-        remove_track(state, bad_track);
+        // Find the "worst" track, skipping the outdated queue entries. Every
+        // selected track has an up-to-date entry in the queue.
+        while (!is_up_to_date(state, queue.top())) {
+            queue.pop();
+        }
+        const std::size_t bad_track = queue.top().track_index;
+        queue.pop();
+
+        LOG_DEBUG_TO(debug_log,
+                     "Remove track "
+                         << bad_track << " n_meas "
+                         << state.n_measurements(bad_track) << " nShared "
+                         << state.shared_measurements_per_track[bad_track]
+                         << " chi2 " << state.track_chi2[bad_track]);
+
+        remove_track(state, bad_track, _config.maximum_shared_hits, queue,
+                     n_ambiguous_tracks);
+        --n_selected_tracks;
         ++iteration_count;
     }
 
-    LOG_DEBUG("Iteration_count: " << iteration_count);
+    LOG_DEBUG_TO(debug_log, "Iteration_count: " << iteration_count);
+    return iteration_count;
 }
 
 }  // namespace traccc
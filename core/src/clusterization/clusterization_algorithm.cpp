@@ -8,18 +8,139 @@
 // Library include(s).
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 
+#include "traccc/clusterization/details/measurement_creation.hpp"
+#include "traccc/clusterization/details/sparse_ccl.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+// System include(s).
+#include <vector>
+
 namespace traccc::host {
 
-clusterization_algorithm::clusterization_algorithm(vecmem::memory_resource& mr)
-    : m_cc(mr), m_mc(mr), m_mr(mr) {}
+clusterization_algorithm::clusterization_algorithm(vecmem::memory_resource& mr,
+                                                   bool parallel)
+    : m_cc(mr), m_mc(mr), m_mr(mr), m_parallel(parallel) {}
 
 clusterization_algorithm::output_type clusterization_algorithm::operator()(
     const cell_collection_types::const_view& cells_view,
     const cell_module_collection_types::const_view& modules_view) const {
 
+    if (m_parallel) {
+        return parallel_clusterization(cells_view, modules_view);
+    }
+
     const sparse_ccl_algorithm::output_type clusters = m_cc(cells_view);
     const auto clusters_data = get_data(clusters);
     return m_mc(clusters_data, modules_view);
 }
 
+clusterization_algorithm::output_type
+clusterization_algorithm::parallel_clusterization(
+    const cell_collection_types::const_view& cells_view,
+    const cell_module_collection_types::const_view& modules_view) const {
+
+    // Create device containers for the inputs.
+    const cell_collection_types::const_device cells{cells_view};
+    const cell_module_collection_types::const_device modules{modules_view};
+    const unsigned int n_cells = cells.size();
+
+    // Find the module boundaries in the cell collection. The cells of every
+    // module are stored contiguously.
+    std::vector<unsigned int> partitions;
+    for (unsigned int i = 0; i < n_cells; ++i) {
+        if ((i == 0) || (cells[i].module_link != cells[i - 1].module_link)) {
+            partitions.push_back(i);
+        }
+    }
+    const std::size_t n_partitions = partitions.size();
+    partitions.push_back(n_cells);
+
+    // Scratch buffers shared by all partitions. Every partition only ever
+    // touches its own range in them.
+    std::vector<unsigned int> labels(n_cells);
+    std::vector<cell> sorted_cells(n_cells);
+    std::vector<unsigned int> cluster_offsets(n_partitions + 1, 0u);
+
+    // Label the cells of every partition.
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, n_partitions),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+            for (std::size_t p = range.begin(); p != range.end(); ++p) {
+                const unsigned int begin = partitions[p];
+                const unsigned int size = partitions[p + 1] - begin;
+                const cell_collection_types::const_device partition_cells{
+                    cell_collection_types::const_view{size, &(cells[begin])}};
+                vecmem::device_vector<unsigned int> partition_labels{
+                    vecmem::data::vector_view<unsigned int>{
+                        size, labels.data() + begin}};
+                cluster_offsets[p + 1] = details::sparse_ccl_row_sweep(
+                    partition_cells, partition_labels);
+            }
+        });
+
+    // Calculate where the clusters of each partition start in the output.
+    for (std::size_t p = 0; p < n_partitions; ++p) {
+        cluster_offsets[p + 1] += cluster_offsets[p];
+    }
+
+    // Create the result object.
+    output_type result(cluster_offsets.back(), &(m_mr.get()));
+    measurement_collection_types::device measurements{vecmem::get_data(result)};
+
+    // Per-cluster cell counters, re-used as insertion positions.
+    std::vector<unsigned int> cluster_positions(cluster_offsets.back(), 0u);
+
+    // Create the measurements of every partition.
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, n_partitions),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+            for (std::size_t p = range.begin(); p != range.end(); ++p) {
+                const unsigned int begin = partitions[p];
+                const unsigned int end = partitions[p + 1];
+                const unsigned int first_cluster = cluster_offsets[p];
+                const unsigned int last_cluster = cluster_offsets[p + 1];
+
+                // Group the cells of the partition by cluster, keeping their
+                // original order within each cluster.
+                for (unsigned int i = begin; i < end; ++i) {
+                    ++cluster_positions[first_cluster + labels[i]];
+                }
+                unsigned int position = begin;
+                for (unsigned int c = first_cluster; c < last_cluster; ++c) {
+                    const unsigned int size = cluster_positions[c];
+                    cluster_positions[c] = position;
+                    position += size;
+                }
+                for (unsigned int i = begin; i < end; ++i) {
+                    sorted_cells[cluster_positions[first_cluster +
+                                                   labels[i]]++] = cells[i];
+                }
+
+                // Create one measurement per cluster. At this point the
+                // position of every cluster points to the end of its cells.
+                const unsigned int mod_link = cells[begin].module_link;
+                const cell_module& mod = modules.at(mod_link);
+                unsigned int cluster_begin = begin;
+                for (unsigned int c = first_cluster; c < last_cluster; ++c) {
+                    const cell_collection_types::const_device cluster{
+                        cell_collection_types::const_view{
+                            cluster_positions[c] - cluster_begin,
+                            sorted_cells.data() + cluster_begin}};
+                    details::fill_measurement(measurements, c, cluster, mod,
+                                              mod_link);
+                    cluster_begin = cluster_positions[c];
+                }
+            }
+        });
+
+    return result;
+}
+
 }  // namespace traccc::host
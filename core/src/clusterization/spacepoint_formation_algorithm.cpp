@@ -41,4 +41,31 @@ spacepoint_formation_algorithm::operator()(
     return result;
 }
 
+slim_spacepoint_collection_types::host
+spacepoint_formation_algorithm::form_slim(
+    const measurement_collection_types::const_view& measurements_view,
+    const cell_module_collection_types::const_view& modules_view) const {
+
+    // Create device containers for the inputs.
+    const measurement_collection_types::const_device measurements{
+        measurements_view};
+    const cell_module_collection_types::const_device modules{modules_view};
+
+    // Create the result container.
+    slim_spacepoint_collection_types::host result(measurements.size(),
+                                                  &(m_mr.get()));
+
+    // Set up each spacepoint in the result container.
+    for (measurement_collection_types::const_device::size_type i = 0;
+         i < measurements.size(); ++i) {
+
+        const measurement& meas = measurements.at(i);
+        details::fill_spacepoint(result[i], meas, i,
+                                 modules.at(meas.module_link));
+    }
+
+    // Return the created container.
+    return result;
+}
+
 }  // namespace traccc::host
@@ -16,8 +16,9 @@
 
 namespace traccc::host {
 
-sparse_ccl_algorithm::sparse_ccl_algorithm(vecmem::memory_resource& mr)
-    : m_mr(mr) {}
+sparse_ccl_algorithm::sparse_ccl_algorithm(vecmem::memory_resource& mr,
+                                           method m)
+    : m_mr(mr), m_method(m) {}
 
 sparse_ccl_algorithm::output_type sparse_ccl_algorithm::operator()(
     const cell_collection_types::const_view& cells_view) const {
@@ -28,7 +29,9 @@ sparse_ccl_algorithm::output_type sparse_ccl_algorithm::operator()(
     vecmem::device_vector<unsigned int> cluster_indices_device{
         vecmem::get_data(cluster_indices)};
     const unsigned int num_clusters =
-        details::sparse_ccl(cells, cluster_indices_device);
+        (m_method == method::row_sweep)
+            ? details::sparse_ccl_row_sweep(cells, cluster_indices_device)
+            : details::sparse_ccl(cells, cluster_indices_device);
 
     // Create the result container.
     output_type clusters(num_clusters, &(m_mr.get()));
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -20,6 +20,23 @@ void seed_filtering::operator()(
     triplet_collection_types::host& triplets,
     seed_collection_types::host& seeds) const {
 
+    filter(sp_collection, g2, triplets, seeds);
+}
+
+void seed_filtering::operator()(
+    const slim_spacepoint_collection_types::host& sp_collection,
+    const sp_grid& g2, triplet_collection_types::host& triplets,
+    seed_collection_types::host& seeds) const {
+
+    filter(sp_collection, g2, triplets, seeds);
+}
+
+template <typename spacepoint_collection_t>
+void seed_filtering::filter(const spacepoint_collection_t& sp_collection,
+                            const sp_grid& g2,
+                            triplet_collection_types::host& triplets,
+                            seed_collection_types::host& seeds) const {
+
     seed_collection_types::host seeds_per_spM;
 
     for (triplet& triplet : triplets) {
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,62 +8,134 @@
 // Library include(s).
 #include "traccc/seeding/seed_finding.hpp"
 
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+// System include(s).
+#include <vector>
+
 namespace traccc {
 
 seed_finding::seed_finding(const seedfinder_config& finder_config,
-                           const seedfilter_config& filter_config)
+                           const seedfilter_config& filter_config,
+                           bool parallel)
     : m_midBot_finding(finder_config),
       m_midTop_finding(finder_config),
       m_triplet_finding(finder_config),
-      m_seed_filtering(filter_config) {}
+      m_seed_filtering(filter_config),
+      m_parallel(parallel) {}
+
+seed_finding::output_type seed_finding::operator()(
+    const spacepoint_collection_types::host& sp_collection, const sp_grid& g2,
+    const sp_soa_grid& soa_grid) const {
+
+    return find(sp_collection, g2, soa_grid);
+}
 
 seed_finding::output_type seed_finding::operator()(
-    const spacepoint_collection_types::host& sp_collection,
-    const sp_grid& g2) const {
+    const slim_spacepoint_collection_types::host& sp_collection,
+    const sp_grid& g2, const sp_soa_grid& soa_grid) const {
+
+    return find(sp_collection, g2, soa_grid);
+}
+
+template <typename spacepoint_collection_t>
+seed_finding::output_type seed_finding::find(
+    const spacepoint_collection_t& sp_collection, const sp_grid& g2,
+    const sp_soa_grid& soa_grid) const {
 
     // Run the algorithm
     output_type seeds;
 
-    for (unsigned int i = 0; i < g2.nbins(); i++) {
-        auto& spM_collection = g2.bin(i);
+    if (!m_parallel) {
+        scratch_buffers scratch;
+        for (unsigned int i = 0; i < g2.nbins(); i++) {
+            find_seeds(sp_collection, g2, soa_grid, i, scratch, seeds);
+        }
+        return seeds;
+    }
 
-        for (unsigned int j = 0; j < spM_collection.size(); ++j) {
+    // Seeds are collected separately for every bin, and are merged in bin
+    // order at the end. This way the result does not depend on how the bins
+    // get distributed between the threads.
+    std::vector<output_type> seeds_per_bin(g2.nbins());
+    tbb::enumerable_thread_specific<scratch_buffers> scratch;
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0u, g2.nbins()),
+                      [&](const tbb::blocked_range<unsigned int>& range) {
+                          scratch_buffers& local_scratch = scratch.local();
+                          for (unsigned int i = range.begin(); i != range.end();
+                               ++i) {
+                              find_seeds(sp_collection, g2, soa_grid, i,
+                                         local_scratch, seeds_per_bin[i]);
+                          }
+                      });
+
+    std::size_t n_seeds = 0;
+    for (const output_type& bin_seeds : seeds_per_bin) {
+        n_seeds += bin_seeds.size();
+    }
+    seeds.reserve(n_seeds);
+    for (const output_type& bin_seeds : seeds_per_bin) {
+        seeds.insert(seeds.end(), bin_seeds.begin(), bin_seeds.end());
+    }
+
+    return seeds;
+}
 
-            sp_location spM_location({i, j});
+template <typename spacepoint_collection_t>
+void seed_finding::find_seeds(const spacepoint_collection_t& sp_collection,
+                              const sp_grid& g2, const sp_soa_grid& soa_grid,
+                              unsigned int bin_idx, scratch_buffers& scratch,
+                              seed_collection_types::host& seeds) const {
 
-            // middule-bottom doublet search
-            auto mid_bot = m_midBot_finding(g2, spM_location);
+    auto& spM_collection = g2.bin(bin_idx);
 
-            if (mid_bot.first.empty())
-                continue;
+    for (unsigned int j = 0; j < spM_collection.size(); ++j) {
 
-            // middule-top doublet search
-            auto mid_top = m_midTop_finding(g2, spM_location);
+        sp_location spM_location({bin_idx, j});
 
-            if (mid_top.first.empty())
-                continue;
+        // middule-bottom doublet search
+        auto& mid_bot = scratch.mid_bot;
+        mid_bot.first.clear();
+        mid_bot.second.clear();
+        m_midBot_finding(soa_grid, spM_location, mid_bot);
 
-            triplet_collection_types::host triplets_per_spM;
+        if (mid_bot.first.empty())
+            continue;
 
-            // triplet search from the combinations of two doublets which
-            // share middle spacepoint
-            for (unsigned int k = 0; k < mid_bot.first.size(); ++k) {
-                auto& doublet_mb = mid_bot.first[k];
-                auto& lb = mid_bot.second[k];
+        // middule-top doublet search
+        auto& mid_top = scratch.mid_top;
+        mid_top.first.clear();
+        mid_top.second.clear();
+        m_midTop_finding(soa_grid, spM_location, mid_top);
 
-                triplet_collection_types::host triplets = m_triplet_finding(
-                    g2, doublet_mb, lb, mid_top.first, mid_top.second);
+        if (mid_top.first.empty())
+            continue;
 
-                triplets_per_spM.insert(std::end(triplets_per_spM),
-                                        triplets.begin(), triplets.end());
-            }
+        auto& triplets_per_spM = scratch.triplets_per_spM;
+        triplets_per_spM.clear();
 
-            // seed filtering
-            m_seed_filtering(sp_collection, g2, triplets_per_spM, seeds);
+        // triplet search from the combinations of two doublets which
+        // share middle spacepoint
+        for (unsigned int k = 0; k < mid_bot.first.size(); ++k) {
+            auto& doublet_mb = mid_bot.first[k];
+            auto& lb = mid_bot.second[k];
+
+            auto& triplets = scratch.triplets;
+            triplets.clear();
+            m_triplet_finding(g2, doublet_mb, lb, mid_top.first,
+                              mid_top.second, triplets,
+                              scratch.triplet_scratch);
+
+            triplets_per_spM.insert(std::end(triplets_per_spM),
+                                    triplets.begin(), triplets.end());
         }
-    }
 
-    return seeds;
+        // seed filtering
+        m_seed_filtering(sp_collection, g2, triplets_per_spM, seeds);
+    }
 }
 
 }  // namespace traccc
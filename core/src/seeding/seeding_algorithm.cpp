@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -26,7 +26,17 @@ seeding_algorithm::seeding_algorithm(const seedfinder_config& finder_config,
 seeding_algorithm::output_type seeding_algorithm::operator()(
     const spacepoint_collection_types::host& spacepoints) const {
 
-    return m_seed_finding(spacepoints, m_spacepoint_binning(spacepoints));
+    const spacepoint_binning::grids_type grids =
+        m_spacepoint_binning.make_grids(spacepoints);
+    return m_seed_finding(spacepoints, grids.grid, grids.soa_grid);
+}
+
+seeding_algorithm::output_type seeding_algorithm::operator()(
+    const slim_spacepoint_collection_types::host& spacepoints) const {
+
+    const spacepoint_binning::grids_type grids =
+        m_spacepoint_binning.make_grids(spacepoints);
+    return m_seed_finding(spacepoints, grids.grid, grids.soa_grid);
 }
 
 }  // namespace traccc
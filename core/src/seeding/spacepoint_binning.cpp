@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,6 +11,9 @@
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/seeding/spacepoint_binning_helper.hpp"
 
+// System include(s).
+#include <utility>
+
 namespace traccc {
 
 spacepoint_binning::spacepoint_binning(
@@ -24,13 +27,42 @@ spacepoint_binning::spacepoint_binning(
 spacepoint_binning::output_type spacepoint_binning::operator()(
     const spacepoint_collection_types::host& sp_collection) const {
 
+    return bin(sp_collection);
+}
+
+spacepoint_binning::output_type spacepoint_binning::operator()(
+    const slim_spacepoint_collection_types::host& sp_collection) const {
+
+    return bin(sp_collection);
+}
+
+spacepoint_binning::grids_type spacepoint_binning::make_grids(
+    const spacepoint_collection_types::host& sp_collection) const {
+
+    output_type grid = bin(sp_collection);
+    sp_soa_grid soa_grid(grid, m_mr.get());
+    return {std::move(grid), std::move(soa_grid)};
+}
+
+spacepoint_binning::grids_type spacepoint_binning::make_grids(
+    const slim_spacepoint_collection_types::host& sp_collection) const {
+
+    output_type grid = bin(sp_collection);
+    sp_soa_grid soa_grid(grid, m_mr.get());
+    return {std::move(grid), std::move(soa_grid)};
+}
+
+template <typename spacepoint_collection_t>
+spacepoint_binning::output_type spacepoint_binning::bin(
+    const spacepoint_collection_t& sp_collection) const {
+
     output_type g2(m_axes.first, m_axes.second, m_mr.get());
 
     auto& phi_axis = g2.axis_p0();
     auto& z_axis = g2.axis_p1();
 
     for (unsigned int i = 0; i < sp_collection.size(); i++) {
-        const spacepoint& sp = sp_collection[i];
+        const auto& sp = sp_collection[i];
         internal_spacepoint<spacepoint> isp(sp, i, m_config.beamPos);
 
         if (is_valid_sp(m_config, sp) !=
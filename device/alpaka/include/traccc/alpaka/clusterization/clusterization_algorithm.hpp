@@ -0,0 +1,77 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+namespace traccc::alpaka {
+
+/// Algorithm performing hit clusterization
+///
+/// This algorithm implements hit clusterization in a massively-parallel
+/// approach, using the same kernel as the CUDA and SYCL implementations. Each
+/// block of threads handles one partition of the detector cells.
+///
+/// On accelerators that can only run a single thread per block (like the
+/// serial and the OpenMP / TBB "blocks" CPU backends), the single thread of
+/// each block is set up to hold up to 1024 cells, and the number of cells per
+/// partition is reduced to a quarter of that. The partitions are then
+/// processed in parallel by the different blocks.
+///
+/// Before running the clusterization, the algorithm checks that no partition
+/// (extended to the end of the cluster that it ends in) exceeds the number of
+/// cells that a block can hold.
+///
+class clusterization_algorithm
+    : public algorithm<measurement_collection_types::buffer(
+          const cell_collection_types::const_view&,
+          const cell_module_collection_types::const_view&)> {
+
+    public:
+    /// Constructor for clusterization algorithm
+    ///
+    /// @param mr The memory resource(s) to use in the algorithm
+    /// @param copy The copy object to use for copying data between device
+    ///             and host memory blocks
+    /// @param target_cells_per_partition the average number of cells in each
+    /// partition
+    ///
+    clusterization_algorithm(const traccc::memory_resource& mr,
+                             vecmem::copy& copy,
+                             const unsigned short target_cells_per_partition);
+
+    /// Callable operator for clusterization algorithm
+    ///
+    /// @param cells        a collection of cells
+    /// @param modules      a collection of modules
+    /// @return a measurement collection (buffer)
+    ///
+    /// @throw std::runtime_error If a partition of the cells would not fit
+    ///                           into the memory of a block
+    ///
+    output_type operator()(
+        const cell_collection_types::const_view& cells,
+        const cell_module_collection_types::const_view& modules) const override;
+
+    private:
+    /// The memory resource(s) to use
+    traccc::memory_resource m_mr;
+    /// The copy object to use
+    vecmem::copy& m_copy;
+    /// The average number of cells in each partition
+    unsigned short m_target_cells_per_partition;
+};
+
+}  // namespace traccc::alpaka
@@ -0,0 +1,240 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "../utils/barrier.hpp"
+#include "../utils/utils.hpp"
+
+// Project include(s).
+#include "traccc/alpaka/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/device/ccl_kernel.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace traccc::alpaka {
+
+/// Whether the CCL kernel runs with a single thread per block
+///
+/// This is the case on all CPU accelerators, as with
+/// @c traccc::alpaka::makeWorkDiv.
+///
+template <typename TAcc>
+inline constexpr bool ccl_single_thread_blocks =
+    !(::alpaka::accMatchesTags<TAcc, ::alpaka::TagGpuCudaRt> ||
+      ::alpaka::accMatchesTags<TAcc, ::alpaka::TagGpuHipRt>);
+
+/// Maximum number of cells processed by one thread of the CCL kernel
+///
+/// With a single thread per block, that one thread needs to be able to hold
+/// all cells of a partition.
+///
+template <typename TAcc>
+inline constexpr int ccl_cells_per_thread =
+    (ccl_single_thread_blocks<TAcc> ? 1024
+                                    : device::details::MAX_CELLS_PER_THREAD);
+
+/// Kernel for running @c traccc::device::check_ccl_partition
+struct CheckCCLPartitionKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc, const unsigned int num_partitions,
+        const cell_collection_types::const_view cells_view,
+        const device::details::index_t max_cells_per_partition,
+        const device::details::index_t target_cells_per_partition,
+        vecmem::data::vector_view<unsigned int> n_oversized_view) const {
+
+        auto const globalThreadIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0u];
+        device::check_ccl_partition(globalThreadIdx, num_partitions,
+                                    cells_view, max_cells_per_partition,
+                                    target_cells_per_partition,
+                                    n_oversized_view);
+    }
+};
+
+/// Kernel for running @c traccc::device::ccl_kernel
+struct CCLKernel {
+    template <typename TAcc>
+    ALPAKA_FN_ACC void operator()(
+        TAcc const& acc, const cell_collection_types::const_view cells_view,
+        const cell_module_collection_types::const_view modules_view,
+        const device::details::index_t max_cells_per_partition,
+        const device::details::index_t target_cells_per_partition,
+        measurement_collection_types::view measurements_view,
+        vecmem::data::vector_view<unsigned int> cell_links) const {
+
+        auto const localThreadIdx =
+            ::alpaka::getIdx<::alpaka::Block, ::alpaka::Threads>(acc)[0u];
+        auto const blockDim =
+            ::alpaka::getWorkDiv<::alpaka::Block, ::alpaka::Threads>(acc)[0u];
+        auto const blockIdx =
+            ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Blocks>(acc)[0u];
+
+        auto& partition_start =
+            ::alpaka::declareSharedVar<unsigned int, __COUNTER__>(acc);
+        auto& partition_end =
+            ::alpaka::declareSharedVar<unsigned int, __COUNTER__>(acc);
+        auto& outi = ::alpaka::declareSharedVar<unsigned int, __COUNTER__>(acc);
+
+        device::details::index_t* const shared_v =
+            ::alpaka::getDynSharedMem<device::details::index_t>(acc);
+        vecmem::data::vector_view<device::details::index_t> f_view{
+            max_cells_per_partition, shared_v};
+        vecmem::data::vector_view<device::details::index_t> gf_view{
+            max_cells_per_partition, shared_v + max_cells_per_partition};
+        traccc::alpaka::barrier<TAcc> barry_r{acc};
+
+        device::ccl_kernel<ccl_cells_per_thread<TAcc>>(
+            static_cast<device::details::index_t>(localThreadIdx),
+            static_cast<device::details::index_t>(blockDim), blockIdx,
+            cells_view, modules_view, max_cells_per_partition,
+            target_cells_per_partition, partition_start, partition_end, outi,
+            f_view, gf_view, barry_r, measurements_view, cell_links);
+    }
+};
+
+clusterization_algorithm::clusterization_algorithm(
+    const traccc::memory_resource& mr, vecmem::copy& copy,
+    const unsigned short target_cells_per_partition)
+    : m_mr(mr),
+      m_copy(copy),
+      m_target_cells_per_partition(target_cells_per_partition) {}
+
+clusterization_algorithm::output_type clusterization_algorithm::operator()(
+    const cell_collection_types::const_view& cells,
+    const cell_module_collection_types::const_view& modules) const {
+
+    // Get the number of cells
+    const cell_collection_types::view::size_type num_cells =
+        m_copy.get_size(cells);
+
+    // Create the result object, overestimating the number of measurements.
+    measurement_collection_types::buffer measurements{
+        num_cells, m_mr.main, vecmem::data::buffer_type::resizable};
+    m_copy.setup(measurements);
+
+    // If there are no cells, return right away.
+    if (num_cells == 0) {
+        return measurements;
+    }
+
+    // Create buffer for linking cells to their measurements.
+    vecmem::data::vector_buffer<unsigned int> cell_links(num_cells, m_mr.main);
+    m_copy.setup(cell_links);
+
+    // Setup alpaka
+    auto devAcc = ::alpaka::getDevByIdx(::alpaka::Platform<Acc>{}, 0u);
+    auto queue = Queue{devAcc};
+    auto const deviceProperties = ::alpaka::getAccDevProps<Acc>(devAcc);
+    auto const maxThreads = deviceProperties.m_blockThreadExtentMax[0];
+
+    // Set up the partitions of the cells. Each block of threads handles one
+    // partition.
+    device::details::index_t target_cells_per_partition =
+        m_target_cells_per_partition;
+    device::details::index_t max_cells_per_partition = 0;
+    unsigned int threads_per_partition = 0;
+    if constexpr (ccl_single_thread_blocks<Acc>) {
+        // Leave the single thread of each block the same room for extending
+        // its partition, as the blocks on GPUs have.
+        max_cells_per_partition = ccl_cells_per_thread<Acc>;
+        target_cells_per_partition = std::min(
+            target_cells_per_partition,
+            static_cast<device::details::index_t>(
+                max_cells_per_partition *
+                device::details::TARGET_CELLS_PER_THREAD /
+                device::details::MAX_CELLS_PER_THREAD));
+        threads_per_partition = 1u;
+    } else {
+        // Make sure that the threads of a single block could process every
+        // cell of a partition.
+        if (maxThreads < (target_cells_per_partition +
+                          device::details::TARGET_CELLS_PER_THREAD - 1) /
+                             device::details::TARGET_CELLS_PER_THREAD) {
+            target_cells_per_partition = static_cast<device::details::index_t>(
+                maxThreads * device::details::TARGET_CELLS_PER_THREAD);
+        }
+        const device::details::ccl_kernel_helper helper{
+            target_cells_per_partition, num_cells};
+        max_cells_per_partition = helper.max_cells_per_partition;
+        threads_per_partition = helper.threads_per_partition;
+    }
+    const unsigned int num_partitions =
+        (num_cells + target_cells_per_partition - 1) /
+        target_cells_per_partition;
+
+    // Check that all partitions fit into the memory reserved for them. Long
+    // enough chains of neighbouring cells could make a partition exceed it.
+    vecmem::data::vector_buffer<unsigned int> n_oversized_buffer(1u,
+                                                                 m_mr.main);
+    m_copy.setup(n_oversized_buffer);
+    m_copy.memset(n_oversized_buffer, 0);
+    const Idx checkThreads = (ccl_single_thread_blocks<Acc> ? 1u : maxThreads);
+    const Idx checkBlocks = (num_partitions + checkThreads - 1) / checkThreads;
+    ::alpaka::exec<Acc>(queue, makeWorkDiv<Acc>(checkBlocks, checkThreads),
+                        CheckCCLPartitionKernel{}, num_partitions, cells,
+                        max_cells_per_partition, target_cells_per_partition,
+                        vecmem::get_data(n_oversized_buffer));
+    ::alpaka::wait(queue);
+    vecmem::vector<unsigned int> n_oversized(m_mr.host ? m_mr.host
+                                                       : &(m_mr.main));
+    m_copy(n_oversized_buffer, n_oversized)->wait();
+    if (n_oversized.at(0) != 0u) {
+        throw std::runtime_error(
+            "Clusterization failed: " + std::to_string(n_oversized.at(0)) +
+            " partition(s) of the cells would have more than " +
+            std::to_string(max_cells_per_partition) +
+            " cells, with a target of " +
+            std::to_string(target_cells_per_partition) +
+            " cells per partition");
+    }
+
+    // Launch ccl kernel. Each block of threads handles a partition of cells.
+    const WorkDiv workDiv{Idx{num_partitions}, Idx{threads_per_partition},
+                          Idx{1u}};
+    ::alpaka::exec<Acc>(queue, workDiv, CCLKernel{}, cells, modules,
+                        max_cells_per_partition, target_cells_per_partition,
+                        vecmem::get_data(measurements),
+                        vecmem::get_data(cell_links));
+    ::alpaka::wait(queue);
+
+    // Return the reconstructed measurements.
+    return measurements;
+}
+
+}  // namespace traccc::alpaka
+
+// Define the required trait needed for Dynamic shared memory allocation.
+namespace alpaka::trait {
+
+template <typename TAcc>
+struct BlockSharedMemDynSizeBytes<traccc::alpaka::CCLKernel, TAcc> {
+    template <typename TVec>
+    ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+        traccc::alpaka::CCLKernel const& /* kernel */,
+        TVec const& /* blockThreadExtent */, TVec const& /* threadElemExtent */,
+        traccc::cell_collection_types::const_view /* cells_view */,
+        traccc::cell_module_collection_types::const_view /* modules_view */,
+        traccc::device::details::index_t max_cells_per_partition,
+        traccc::device::details::index_t /* target_cells_per_partition */,
+        traccc::measurement_collection_types::view /* measurements_view */,
+        vecmem::data::vector_view<unsigned int> /* cell_links */
+        ) -> std::size_t {
+        return 2u * static_cast<std::size_t>(max_cells_per_partition) *
+               sizeof(traccc::device::details::index_t);
+    }
+};
+
+}  // namespace alpaka::trait
@@ -0,0 +1,36 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Alpaka include(s).
+#include <alpaka/alpaka.hpp>
+
+namespace traccc::alpaka {
+
+/// Block-wide synchronisation for the common device code, using an alpaka
+/// accelerator
+template <typename TAcc>
+struct barrier {
+
+    ALPAKA_FN_ACC
+    explicit barrier(TAcc const& acc) : m_acc(acc) {}
+
+    ALPAKA_FN_ACC
+    void blockBarrier() { ::alpaka::syncBlockThreads(m_acc); }
+
+    ALPAKA_FN_ACC
+    bool blockOr(bool predicate) {
+        return ::alpaka::syncBlockThreadsPredicate<::alpaka::BlockOr>(
+                   m_acc, static_cast<int>(predicate)) != 0;
+    }
+
+    private:
+    TAcc const& m_acc;
+};
+
+}  // namespace traccc::alpaka
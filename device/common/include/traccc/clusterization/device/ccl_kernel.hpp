@@ -63,8 +63,44 @@ struct ccl_kernel_helper {
 
 };  // struct ccl_kernel_helper
 
+/// Find the range of cells processed by one partition of @c ccl_kernel
+///
+/// The partition starts from a range of @c target_cells_per_partition cells,
+/// which is extended such that no cluster would cross its boundaries.
+///
+/// @param[in] cells      collection of cells
+/// @param[in] partition  index of the partition
+/// @param[in] target_cells_per_partition average number of cells per
+///                                       partition
+/// @param[out] start     index of the first cell of the partition
+/// @param[out] end       index past the last cell of the partition
+///
+TRACCC_HOST_DEVICE inline void find_partition(
+    const cell_collection_types::const_device& cells, unsigned int partition,
+    index_t target_cells_per_partition, unsigned int& start,
+    unsigned int& end);
+
 }  // namespace details
 
+/// Function checking whether a partition of @c ccl_kernel would fit into the
+/// memory reserved for it
+///
+/// @param[in] globalIndex  The index of the partition to check
+/// @param[in] num_partitions The total number of partitions
+/// @param[in] cells_view    collection of cells
+/// @param[in] max_cells_per_partition maximum number of cells per partition
+/// @param[in] target_cells_per_partition average number of cells per
+///                                       partition
+/// @param[out] n_oversized_view Counter (of size 1) of the partitions with
+///                              more than @c max_cells_per_partition cells
+///
+TRACCC_HOST_DEVICE inline void check_ccl_partition(
+    std::size_t globalIndex, unsigned int num_partitions,
+    const cell_collection_types::const_view cells_view,
+    const details::index_t max_cells_per_partition,
+    const details::index_t target_cells_per_partition,
+    vecmem::data::vector_view<unsigned int> n_oversized_view);
+
 /// Function which reads raw detector cells and turns them into measurements.
 ///
 /// @param[in] threadId current thread index
@@ -85,7 +121,11 @@ struct ccl_kernel_helper {
 /// @param[out] measurements_view collection of measurements
 /// @param[out] cell_links    collection of links to measurements each cell is
 /// put into
-template <typename barrier_t>
+/// @tparam cells_per_thread The maximum number of cells that a single thread
+///                          processes. @c max_cells_per_partition must be
+///                          equal to this times the block size.
+template <int cells_per_thread = details::MAX_CELLS_PER_THREAD,
+          typename barrier_t>
 TRACCC_DEVICE inline void ccl_kernel(
     details::index_t threadId, details::index_t blckDim, unsigned int blockId,
     const cell_collection_types::const_view cells_view,
@@ -1,15 +1,23 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #pragma once
 
+// Project include(s).
 #include "traccc/clusterization/device/aggregate_cluster.hpp"
 #include "traccc/clusterization/device/reduce_problem_cell.hpp"
 
+// VecMem include(s).
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+
 namespace traccc::device {
 
 /// Implementation of a FastSV algorithm with the following steps:
@@ -32,12 +40,12 @@ namespace traccc::device {
 ///                     iteration.
 /// @param[in] barrier  A generic object for block-wide synchronisation
 ///
-template <typename barrier_t>
+template <int cells_per_thread, typename barrier_t>
 TRACCC_DEVICE void fast_sv_1(
     vecmem::device_vector<details::index_t>& f,
     vecmem::device_vector<details::index_t>& gf,
-    unsigned char adjc[details::MAX_CELLS_PER_THREAD],
-    details::index_t adjv[details::MAX_CELLS_PER_THREAD][8],
+    unsigned char adjc[cells_per_thread],
+    details::index_t adjv[cells_per_thread][8],
     const details::index_t tid, const details::index_t blckDim,
     barrier_t& barrier) {
     /*
@@ -61,8 +69,7 @@ TRACCC_DEVICE void fast_sv_1(
          * cluster ID if it is lower than ours, essentially merging the two
          * together.
          */
-        for (details::index_t tst = 0; tst < details::MAX_CELLS_PER_THREAD;
-             ++tst) {
+        for (details::index_t tst = 0; tst < cells_per_thread; ++tst) {
             const details::index_t cid = tst * blckDim + tid;
 
             __builtin_assume(adjc[tst] <= 8);
@@ -83,8 +90,7 @@ TRACCC_DEVICE void fast_sv_1(
         barrier.blockBarrier();
 
 #pragma unroll
-        for (details::index_t tst = 0; tst < details::MAX_CELLS_PER_THREAD;
-             ++tst) {
+        for (details::index_t tst = 0; tst < cells_per_thread; ++tst) {
             const details::index_t cid = tst * blckDim + tid;
             /*
              * The second stage is shortcutting, which is an optimisation that
@@ -102,8 +108,7 @@ TRACCC_DEVICE void fast_sv_1(
         barrier.blockBarrier();
 
 #pragma unroll
-        for (details::index_t tst = 0; tst < details::MAX_CELLS_PER_THREAD;
-             ++tst) {
+        for (details::index_t tst = 0; tst < cells_per_thread; ++tst) {
             const details::index_t cid = tst * blckDim + tid;
             /*
              * Update the array for the next generation, keeping track of any
@@ -125,7 +130,72 @@ TRACCC_DEVICE void fast_sv_1(
     } while (barrier.blockOr(gf_changed));
 }
 
-template <typename barrier_t>
+TRACCC_HOST_DEVICE inline void details::find_partition(
+    const cell_collection_types::const_device& cells, unsigned int partition,
+    index_t target_cells_per_partition, unsigned int& start,
+    unsigned int& end) {
+
+    const cell_collection_types::const_device::size_type num_cells =
+        cells.size();
+
+    /*
+     * We start from an initial range determined by the partition index
+     * multiplied by the target number of cells per partition. We then shift
+     * both the start and the end of the partition forward (to a later point
+     * in the array); start and end may be moved different amounts.
+     */
+    start = partition * target_cells_per_partition;
+    assert(start < num_cells);
+    end = std::min(num_cells, start + target_cells_per_partition);
+
+    /*
+     * Next, shift the starting point to a position further in the array; the
+     * purpose of this is to ensure that we are not operating on any cells
+     * that have been claimed by the previous partition (if any).
+     */
+    while (start != 0 &&
+           cells[start - 1].module_link == cells[start].module_link &&
+           cells[start].channel1 <= cells[start - 1].channel1 + 1) {
+        ++start;
+    }
+
+    /*
+     * Then, claim as many cells as we need past the naive end of the current
+     * partition to ensure that we do not end our partition on a cell that is
+     * not a possible boundary!
+     */
+    while (end < num_cells &&
+           cells[end - 1].module_link == cells[end].module_link &&
+           cells[end].channel1 <= cells[end - 1].channel1 + 1) {
+        ++end;
+    }
+    assert(start <= end);
+}
+
+TRACCC_HOST_DEVICE inline void check_ccl_partition(
+    std::size_t globalIndex, unsigned int num_partitions,
+    const cell_collection_types::const_view cells_view,
+    const details::index_t max_cells_per_partition,
+    const details::index_t target_cells_per_partition,
+    vecmem::data::vector_view<unsigned int> n_oversized_view) {
+
+    if (globalIndex >= num_partitions) {
+        return;
+    }
+
+    const cell_collection_types::const_device cells_device(cells_view);
+    unsigned int start = 0, end = 0;
+    details::find_partition(cells_device,
+                            static_cast<unsigned int>(globalIndex),
+                            target_cells_per_partition, start, end);
+    if (end - start > max_cells_per_partition) {
+        vecmem::device_vector<unsigned int> n_oversized(n_oversized_view);
+        vecmem::device_atomic_ref<unsigned int>(n_oversized.at(0))
+            .fetch_add(1u);
+    }
+}
+
+template <int cells_per_thread, typename barrier_t>
 TRACCC_DEVICE inline void ccl_kernel(
     const details::index_t threadId, const details::index_t blckDim,
     const unsigned int blockId,
@@ -147,59 +217,23 @@ TRACCC_DEVICE inline void ccl_kernel(
     vecmem::device_vector<details::index_t> f(f_view);
     vecmem::device_vector<details::index_t> gf(gf_view);
 
-    const cell_collection_types::const_device::size_type num_cells =
-        cells_device.size();
-
     /*
      * First, we determine the exact range of cells that is to be examined
-     * by this block of threads. We start from an initial range determined
-     * by the block index multiplied by the target number of cells per
-     * block. We then shift both the start and the end of the block forward
-     * (to a later point in the array); start and end may be moved different
-     * amounts.
+     * by this block of threads.
      */
     if (threadId == 0) {
-        unsigned int start = blockId * target_cells_per_partition;
-        assert(start < num_cells);
-        unsigned int end =
-            std::min(num_cells, start + target_cells_per_partition);
+        unsigned int start = 0, end = 0;
+        details::find_partition(cells_device, blockId,
+                                target_cells_per_partition, start, end);
         outi = 0;
-
-        /*
-         * Next, shift the starting point to a position further in the
-         * array; the purpose of this is to ensure that we are not operating
-         * on any cells that have been claimed by the previous block (if
-         * any).
-         */
-        while (start != 0 &&
-               cells_device[start - 1].module_link ==
-                   cells_device[start].module_link &&
-               cells_device[start].channel1 <=
-                   cells_device[start - 1].channel1 + 1) {
-            ++start;
-        }
-
-        /*
-         * Then, claim as many cells as we need past the naive end of the
-         * current block to ensure that we do not end our partition on a
-         * cell that is not a possible boundary!
-         */
-        while (end < num_cells &&
-               cells_device[end - 1].module_link ==
-                   cells_device[end].module_link &&
-               cells_device[end].channel1 <=
-                   cells_device[end - 1].channel1 + 1) {
-            ++end;
-        }
         partition_start = start;
         partition_end = end;
-        assert(partition_start <= partition_end);
     }
 
     barrier.blockBarrier();
 
     // Vector of indices of the adjacent cells
-    details::index_t adjv[details::MAX_CELLS_PER_THREAD][8];
+    details::index_t adjv[cells_per_thread][8];
     /*
      * The number of adjacent cells for each cell must start at zero, to
      * avoid uninitialized memory. adjv does not need to be zeroed, as
@@ -207,7 +241,7 @@ TRACCC_DEVICE inline void ccl_kernel(
      * is set.
      */
     // Number of adjacent cells
-    unsigned char adjc[details::MAX_CELLS_PER_THREAD];
+    unsigned char adjc[cells_per_thread];
 
     // It seems that sycl runs into undefined behaviour when calling
     // group synchronisation functions when some threads have already run
@@ -218,7 +252,7 @@ TRACCC_DEVICE inline void ccl_kernel(
     assert(size <= max_cells_per_partition);
 
 #pragma unroll
-    for (details::index_t tst = 0; tst < details::MAX_CELLS_PER_THREAD; ++tst) {
+    for (details::index_t tst = 0; tst < cells_per_thread; ++tst) {
         adjc[tst] = 0;
     }
 
@@ -227,13 +261,13 @@ TRACCC_DEVICE inline void ccl_kernel(
         /*
          * Look for adjacent cells to the current one.
          */
-        assert(tst < details::MAX_CELLS_PER_THREAD);
+        assert(tst < cells_per_thread);
         reduce_problem_cell(cells_device, cid, partition_start, partition_end,
                             adjc[tst], adjv[tst]);
     }
 
 #pragma unroll
-    for (details::index_t tst = 0; tst < details::MAX_CELLS_PER_THREAD; ++tst) {
+    for (details::index_t tst = 0; tst < cells_per_thread; ++tst) {
         const details::index_t cid = tst * blckDim + threadId;
         /*
          * At the start, the values of f and gf should be equal to the
@@ -253,7 +287,8 @@ TRACCC_DEVICE inline void ccl_kernel(
      * Run FastSV algorithm, which will update the father index to that of
      * the cell belonging to the same cluster with the lowest index.
      */
-    fast_sv_1(f, gf, adjc, adjv, threadId, blckDim, barrier);
+    fast_sv_1<cells_per_thread>(f, gf, adjc, adjv, threadId, blckDim,
+                                barrier);
 
     barrier.blockBarrier();
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,8 @@
 
 // Project include(s).
 #include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement_index.hpp"
+#include "traccc/edm/track_parameters.hpp"
 
 namespace traccc::device {
 
@@ -17,9 +19,7 @@ namespace traccc::device {
 ///
 /// @param[in] globalIndex           The index of the current thread
 /// @param[in] params_view           Input parameters view object
-/// @param[in] barcodes_view         Barcodes view object
-/// @param[in] upper_bounds          Upper bounds of measurements w.r.t geometry
-/// ID
+/// @param[in] meas_index_view       Index of the measurements per surface
 /// @param[out] n_measurements_view  The number of measurements per parameter
 /// @param[out] ref_meas_idx         The first index of measurements per
 /// parameter
@@ -29,8 +29,7 @@ namespace traccc::device {
 TRACCC_DEVICE inline void count_measurements(
     std::size_t globalIndex,
     bound_track_parameters_collection_types::const_view params_view,
-    vecmem::data::vector_view<const detray::geometry::barcode> barcodes_view,
-    vecmem::data::vector_view<const unsigned int> upper_bounds_view,
+    measurement_index_collection_types::const_view meas_index_view,
     const unsigned int n_in_params,
     vecmem::data::vector_view<unsigned int> n_measurements_view,
     vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
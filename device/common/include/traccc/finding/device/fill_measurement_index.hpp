@@ -0,0 +1,31 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
+
+namespace traccc::device {
+
+/// Function filling the measurement index of the event
+///
+/// @param[in] globalIndex        The index of the current thread
+/// @param[in] measurements_view  Measurement container view object (sorted)
+/// @param[out] meas_index_view   Zero-initialised measurement index
+///
+TRACCC_DEVICE inline void fill_measurement_index(
+    std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    measurement_index_collection_types::view meas_index_view);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "traccc/finding/device/impl/fill_measurement_index.ipp"
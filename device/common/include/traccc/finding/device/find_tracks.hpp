@@ -23,8 +23,6 @@ namespace traccc::device {
 /// @param[in] cfg                Track finding config object
 /// @param[in] det_data           Detector view object
 /// @param[in] measurements_view  Measurements container view
-/// @param[in] upper_bounds_view  Upper bounds of measurements unique w.r.t
-/// barcode
 /// @param[in] in_params_view     Input parameters
 /// @param[in] n_measurements_prefix_sum_view  Prefix sum of the number of
 /// measurements per parameter
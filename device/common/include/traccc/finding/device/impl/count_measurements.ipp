@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,17 +12,15 @@ namespace traccc::device {
 TRACCC_DEVICE inline void count_measurements(
     std::size_t globalIndex,
     bound_track_parameters_collection_types::const_view params_view,
-    vecmem::data::vector_view<const detray::geometry::barcode> barcodes_view,
-    vecmem::data::vector_view<const unsigned int> upper_bounds_view,
+    measurement_index_collection_types::const_view meas_index_view,
     const unsigned int n_in_params,
     vecmem::data::vector_view<unsigned int> n_measurements_view,
     vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
     unsigned int& n_measurements_sum) {
 
     bound_track_parameters_collection_types::const_device params(params_view);
-    vecmem::device_vector<const detray::geometry::barcode> barcodes(
-        barcodes_view);
-    vecmem::device_vector<const unsigned int> upper_bounds(upper_bounds_view);
+    measurement_index_collection_types::const_device meas_index(
+        meas_index_view);
     vecmem::device_vector<unsigned int> n_measurements(n_measurements_view);
     vecmem::device_vector<unsigned int> ref_meas_idx(ref_meas_idx_view);
 
@@ -30,24 +28,19 @@ TRACCC_DEVICE inline void count_measurements(
         return;
     }
 
-    // Get barcode
-    const auto bcd = params.at(globalIndex).surface_link();
-    const auto lo =
-        thrust::lower_bound(thrust::seq, barcodes.begin(), barcodes.end(), bcd);
+    // Get the measurements range on the surface of the parameter
+    const measurement_range range =
+        get_measurement_range(meas_index, params.at(globalIndex).surface_link());
 
-    // If barcode is not found (no measurement)
-    if (lo == barcodes.end()) {
+    // If there is no measurement on the surface
+    if (range.size() == 0u) {
         return;
     }
 
-    const auto bcd_id = std::distance(barcodes.begin(), lo);
-
     // Get the reference measurement index and the number of measurements per
     // parameter
-    ref_meas_idx.at(globalIndex) =
-        lo == barcodes.begin() ? 0u : upper_bounds[bcd_id - 1];
-    n_measurements.at(globalIndex) =
-        upper_bounds[bcd_id] - ref_meas_idx.at(globalIndex);
+    ref_meas_idx.at(globalIndex) = range.begin;
+    n_measurements.at(globalIndex) = range.size();
 
     // Increase the total number of measurements with atomic addition
     vecmem::device_atomic_ref<unsigned int> n_meas_sum(n_measurements_sum);
@@ -0,0 +1,24 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::device {
+
+TRACCC_DEVICE inline void fill_measurement_index(
+    std::size_t globalIndex,
+    measurement_collection_types::const_view measurements_view,
+    measurement_index_collection_types::view meas_index_view) {
+
+    const measurement_collection_types::const_device measurements(
+        measurements_view);
+    measurement_index_collection_types::device meas_index(meas_index_view);
+
+    traccc::fill_measurement_index(globalIndex, measurements, meas_index);
+}
+
+}  // namespace traccc::device
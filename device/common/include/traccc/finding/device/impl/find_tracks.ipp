@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -101,10 +101,10 @@ TRACCC_DEVICE inline void find_tracks(
         track_state<typename detector_t::algebra_type> trk_state(meas);
         const detray::surface<detector_t> sf{det, bcd};
 
-        // Run the Kalman update
+        // Run the Kalman update, for measurements passing the chi2 cut
         sf.template visit_mask<
-            gain_matrix_updater<typename detector_t::algebra_type>>(trk_state,
-                                                                    in_par);
+            gain_matrix_updater<typename detector_t::algebra_type>>(
+            trk_state, in_par, cfg.chi2_max);
         // Get the chi-square
         const auto chi2 = trk_state.filtered_chi2();
 
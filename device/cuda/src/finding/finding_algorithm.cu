@@ -11,13 +11,14 @@
 #include "traccc/cuda/finding/finding_algorithm.hpp"
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/edm/device/finding_global_counter.hpp"
+#include "traccc/edm/measurement_index.hpp"
 #include "traccc/finding/candidate_link.hpp"
 #include "traccc/finding/device/add_links_for_holes.hpp"
 #include "traccc/finding/device/apply_interaction.hpp"
 #include "traccc/finding/device/build_tracks.hpp"
 #include "traccc/finding/device/count_measurements.hpp"
+#include "traccc/finding/device/fill_measurement_index.hpp"
 #include "traccc/finding/device/find_tracks.hpp"
-#include "traccc/finding/device/make_barcode_sequence.hpp"
 #include "traccc/finding/device/propagate_to_next_surface.hpp"
 #include "traccc/finding/device/prune_tracks.hpp"
 
@@ -38,9 +39,10 @@
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/scan.h>
 #include <thrust/sort.h>
-#include <thrust/unique.h>
+#include <thrust/transform_reduce.h>
 
 // System include(s).
 #include <vector>
@@ -49,14 +51,14 @@ namespace traccc::cuda {
 
 namespace kernels {
 
-/// CUDA kernel for running @c traccc::device::make_barcode_sequence
-__global__ void make_barcode_sequence(
+/// CUDA kernel for running @c traccc::device::fill_measurement_index
+__global__ void fill_measurement_index(
     measurement_collection_types::const_view measurements_view,
-    vecmem::data::vector_view<detray::geometry::barcode> barcodes_view) {
+    measurement_index_collection_types::view meas_index_view) {
 
     int gid = threadIdx.x + blockIdx.x * blockDim.x;
 
-    device::make_barcode_sequence(gid, measurements_view, barcodes_view);
+    device::fill_measurement_index(gid, measurements_view, meas_index_view);
 }
 
 /// CUDA kernel for running @c traccc::device::apply_interaction
@@ -73,8 +75,7 @@ __global__ void apply_interaction(
 /// CUDA kernel for running @c traccc::device::count_measurements
 __global__ void count_measurements(
     bound_track_parameters_collection_types::const_view params_view,
-    vecmem::data::vector_view<const detray::geometry::barcode> barcodes_view,
-    vecmem::data::vector_view<const unsigned int> upper_bounds_view,
+    measurement_index_collection_types::const_view meas_index_view,
     const unsigned int n_in_params,
     vecmem::data::vector_view<unsigned int> n_measurements_view,
     vecmem::data::vector_view<unsigned int> ref_meas_idx_view,
@@ -82,9 +83,9 @@ __global__ void count_measurements(
 
     int gid = threadIdx.x + blockIdx.x * blockDim.x;
 
-    device::count_measurements(
-        gid, params_view, barcodes_view, upper_bounds_view, n_in_params,
-        n_measurements_view, ref_meas_idx_view, n_measurements_sum);
+    device::count_measurements(gid, params_view, meas_index_view, n_in_params,
+                               n_measurements_view, ref_meas_idx_view,
+                               n_measurements_sum);
 }
 
 /// CUDA kernel for running @c traccc::device::find_tracks
@@ -270,41 +271,32 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
     measurement_collection_types::const_view::size_type n_measurements =
         m_copy.get_size(measurements);
 
-    // Get copy of barcode uniques
-    measurement_collection_types::buffer uniques_buffer{n_measurements,
-                                                        m_mr.main};
-    measurement_collection_types::device uniques(uniques_buffer);
-
-    measurement* end =
-        thrust::unique_copy(thrust::cuda::par.on(stream), measurements.ptr(),
-                            measurements.ptr() + n_measurements,
-                            uniques.begin(), measurement_equal_comp());
-    unsigned int n_modules = end - uniques.begin();
-
-    // Get upper bounds of unique elements
-    vecmem::data::vector_buffer<unsigned int> upper_bounds_buffer{n_modules,
-                                                                  m_mr.main};
-    vecmem::device_vector<unsigned int> upper_bounds(upper_bounds_buffer);
-
-    thrust::upper_bound(thrust::cuda::par.on(stream), measurements.ptr(),
-                        measurements.ptr() + n_measurements, uniques.begin(),
-                        uniques.begin() + n_modules, upper_bounds.begin(),
-                        measurement_sort_comp());
+    // Size of the measurement index, from the largest surface index
+    const unsigned int n_surfaces =
+        thrust::transform_reduce(thrust::cuda::par.on(stream),
+                                 measurements.ptr(),
+                                 measurements.ptr() + n_measurements,
+                                 measurement_surface_index{}, 0u,
+                                 thrust::maximum<unsigned int>()) +
+        1u;
 
     /*****************************************************************
-     * Kernel1: Create barcode sequence
+     * Kernel1: Create the measurement index
      *****************************************************************/
 
-    vecmem::data::vector_buffer<detray::geometry::barcode> barcodes_buffer{
-        n_modules, m_mr.main};
+    measurement_index_collection_types::buffer meas_index_buffer{n_surfaces,
+                                                                 m_mr.main};
+    m_copy.setup(meas_index_buffer);
+    m_copy.memset(meas_index_buffer, 0)->ignore();
 
     unsigned int nThreads = m_warp_size * 2;
-    unsigned int nBlocks = (barcodes_buffer.size() + nThreads - 1) / nThreads;
+    unsigned int nBlocks = (n_measurements + nThreads - 1) / nThreads;
 
-    kernels::make_barcode_sequence<<<nBlocks, nThreads, 0, stream>>>(
-        uniques_buffer, barcodes_buffer);
-
-    TRACCC_CUDA_ERROR_CHECK(cudaGetLastError());
+    if (nBlocks > 0) {
+        kernels::fill_measurement_index<<<nBlocks, nThreads, 0, stream>>>(
+            measurements, meas_index_buffer);
+        TRACCC_CUDA_ERROR_CHECK(cudaGetLastError());
+    }
 
     for (unsigned int step = 0; step < m_cfg.max_track_candidates_per_track;
          step++) {
@@ -368,7 +360,7 @@ finding_algorithm<stepper_t, navigator_t>::operator()(
         nThreads = m_warp_size * 2;
         nBlocks = (n_in_params + nThreads - 1) / nThreads;
         kernels::count_measurements<<<nBlocks, nThreads, 0, stream>>>(
-            in_params_buffer, barcodes_buffer, upper_bounds_buffer, n_in_params,
+            in_params_buffer, meas_index_buffer, n_in_params,
             n_measurements_buffer, ref_meas_idx_buffer,
             (*global_counter_device).n_measurements_sum);
         TRACCC_CUDA_ERROR_CHECK(cudaGetLastError());
@@ -6,6 +6,7 @@
  */
 
 // Project include(s).
+#include "traccc/io/archive_writer.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
@@ -22,6 +23,7 @@
 
 // System include(s).
 #include <cstdlib>
+#include <optional>
 
 int create_binaries(const traccc::opts::detector& detector_opts,
                     const traccc::opts::input_data& input_opts,
@@ -38,6 +40,27 @@ int create_binaries(const traccc::opts::detector& detector_opts,
     // Memory resource used by the EDM.
     vecmem::host_memory_resource host_mr;
 
+    // Write one file per event and collection, unless an archive is
+    // requested. A new archive replaces any earlier one in the directory.
+    std::optional<traccc::io::archive_writer> archive;
+    if (output_opts.format == traccc::data_format::archive) {
+        archive.emplace(output_opts.directory);
+    }
+
+    // Helper writing one collection of an event in the requested format.
+    auto write = [&](unsigned int event, const auto& collection,
+                     const auto& modules) {
+        if (archive) {
+            archive->write(event, vecmem::get_data(collection),
+                           vecmem::get_data(modules));
+        } else {
+            traccc::io::write(event, output_opts.directory,
+                              traccc::data_format::binary,
+                              vecmem::get_data(collection),
+                              vecmem::get_data(modules));
+        }
+    };
+
     // Loop over events
     for (unsigned int event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
@@ -49,10 +72,7 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                                &digi_cfg);
 
         // Write binary file
-        traccc::io::write(event, output_opts.directory,
-                          traccc::data_format::binary,
-                          vecmem::get_data(cells_csv.cells),
-                          vecmem::get_data(cells_csv.modules));
+        write(event, cells_csv.cells, cells_csv.modules);
 
         // Read the hits from the relevant event file
         traccc::io::spacepoint_reader_output spacepoints_csv(&host_mr);
@@ -61,10 +81,7 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                                      input_opts.format);
 
         // Write binary file
-        traccc::io::write(event, output_opts.directory,
-                          traccc::data_format::binary,
-                          vecmem::get_data(spacepoints_csv.spacepoints),
-                          vecmem::get_data(spacepoints_csv.modules));
+        write(event, spacepoints_csv.spacepoints, spacepoints_csv.modules);
 
         // Read the measurements from the relevant event file
         traccc::io::measurement_reader_output measurements_csv(&host_mr);
@@ -72,10 +89,12 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                                       input_opts.directory, input_opts.format);
 
         // Write binary file
-        traccc::io::write(event, output_opts.directory,
-                          traccc::data_format::binary,
-                          vecmem::get_data(measurements_csv.measurements),
-                          vecmem::get_data(measurements_csv.modules));
+        write(event, measurements_csv.measurements, measurements_csv.modules);
+    }
+
+    // Write the event table of the archive.
+    if (archive) {
+        archive->close();
     }
 
     return EXIT_SUCCESS;
@@ -0,0 +1,44 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/options/details/interface.hpp"
+
+// System include(s).
+#include <string>
+
+namespace traccc::opts {
+
+/// Options for the binary cache of the detector description
+///
+/// The cache holds the module placements and the digitization configuration
+/// used by the event data readers. It does not hold the Detray detector,
+/// which is still read from its JSON files.
+///
+class detector_cache : public interface {
+
+    public:
+    /// @name Options
+    /// @{
+
+    /// The cache file to use (none if empty)
+    std::string cache_file;
+
+    /// @}
+
+    /// Constructor
+    detector_cache();
+
+    private:
+    /// Print the specific options of this class
+    std::ostream& print_impl(std::ostream& out) const override;
+
+};  // class detector_cache
+
+}  // namespace traccc::opts
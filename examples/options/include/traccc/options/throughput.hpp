@@ -29,6 +29,24 @@ class throughput : public interface {
     /// them in the performance measurements
     std::size_t cold_run_events = 10;
 
+    /// Read the events on the fly, instead of loading all of them up front
+    bool stream_events = false;
+    /// The maximum number of events to prefetch while streaming
+    std::size_t prefetch_events = 8;
+    /// The number of threads reading the events while streaming
+    std::size_t reader_threads = 1;
+    /// Include the time spent waiting for input in the measurements
+    bool io_inclusive = false;
+
+    /// Process the events in a pipeline of reconstruction stages
+    bool pipeline = false;
+    /// The maximum number of events in flight in the pipeline (zero meaning
+    /// twice the number of threads)
+    std::size_t pipeline_tokens = 0;
+
+    /// Record the latencies of the individual reconstruction stages
+    bool stage_latencies = false;
+
     /// Output log file
     std::string log_file;
 
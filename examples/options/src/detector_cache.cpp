@@ -0,0 +1,32 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/options/detector_cache.hpp"
+
+// System include(s).
+#include <iostream>
+
+namespace traccc::opts {
+
+detector_cache::detector_cache() : interface("Detector Cache Options") {
+
+    m_desc.add_options()(
+        "detector-cache",
+        boost::program_options::value(&cache_file)->default_value(cache_file),
+        "Binary cache of the module placements and digitization configuration "
+        "(rebuilt when the source files change, does not cache the Detray "
+        "detector)");
+}
+
+std::ostream& detector_cache::print_impl(std::ostream& out) const {
+
+    out << "  Detector cache: " << (cache_file.empty() ? "none" : cache_file);
+    return out;
+}
+
+}  // namespace traccc::opts
@@ -43,6 +43,8 @@ void output_data::read(const boost::program_options::variables_map& vm) {
             format = data_format::csv;
         } else if (input_format_string == "binary") {
             format = data_format::binary;
+        } else if (input_format_string == "archive") {
+            format = data_format::archive;
         } else if (input_format_string == "json") {
             format = data_format::json;
         } else if (input_format_string == "obj") {
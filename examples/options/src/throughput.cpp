@@ -26,15 +26,54 @@ throughput::throughput() : interface("Throughput Measurement Options") {
         "cold-run-events",
         po::value(&cold_run_events)->default_value(cold_run_events),
         "Number of events to run 'cold'");
+    m_desc.add_options()(
+        "stream-events", po::bool_switch(&stream_events),
+        "Read the events on the fly, instead of loading all of them up front");
+    m_desc.add_options()(
+        "prefetch-events",
+        po::value(&prefetch_events)->default_value(prefetch_events),
+        "Maximum number of events to prefetch while streaming");
+    m_desc.add_options()(
+        "reader-threads",
+        po::value(&reader_threads)->default_value(reader_threads),
+        "Number of threads reading the events while streaming");
+    m_desc.add_options()(
+        "io-inclusive", po::bool_switch(&io_inclusive),
+        "Include the time spent waiting for input in the measurements");
+    m_desc.add_options()(
+        "pipeline", po::bool_switch(&pipeline),
+        "Process the events in a pipeline of reconstruction stages "
+        "(read, clusterize, seed, find, fit, resolve ambiguities)");
+    m_desc.add_options()(
+        "pipeline-tokens",
+        po::value(&pipeline_tokens)->default_value(pipeline_tokens),
+        "Maximum number of events in flight in the pipeline (0: twice the "
+        "number of threads)");
+    m_desc.add_options()(
+        "stage-latencies", po::bool_switch(&stage_latencies),
+        "Record the latencies of the individual reconstruction stages");
     m_desc.add_options()(
         "log-file", po::value(&log_file),
-        "File where result logs will be printed (in append mode).");
+        "File where result logs will be printed (in append mode). The event "
+        "latencies are written next to it, in JSON and CSV formats.");
 }
 
 std::ostream& throughput::print_impl(std::ostream& out) const {
 
     out << "  Cold run event(s) : " << cold_run_events << "\n"
         << "  Processed event(s): " << processed_events << "\n"
+        << "  Stream events     : " << (stream_events ? "yes" : "no") << "\n";
+    if (stream_events) {
+        out << "  Prefetch event(s) : " << prefetch_events << "\n"
+            << "  Reader thread(s)  : " << reader_threads << "\n"
+            << "  I/O inclusive     : " << (io_inclusive ? "yes" : "no")
+            << "\n";
+    }
+    out << "  Pipeline          : " << (pipeline ? "yes" : "no") << "\n";
+    if (pipeline) {
+        out << "  Pipeline tokens   : " << pipeline_tokens << "\n";
+    }
+    out << "  Stage latencies   : " << (stage_latencies ? "yes" : "no") << "\n"
         << "  Log file          : " << log_file;
     return out;
 }
@@ -0,0 +1,203 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// I/O include(s).
+#include "traccc/io/reader_edm.hpp"
+
+// Performance measurement include(s).
+#include "traccc/performance/timing_info.hpp"
+
+// TBB include(s).
+#include <tbb/concurrent_queue.h>
+#include <tbb/parallel_pipeline.h>
+
+// System include(s).
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace traccc {
+
+namespace details {
+
+/// Trait checking whether a full chain algorithm can be run stage by stage
+template <typename FULL_CHAIN_ALG, typename = void>
+struct has_reconstruction_stages : std::false_type {};
+
+/// Specialisation for algorithms providing all reconstruction stages
+template <typename FULL_CHAIN_ALG>
+struct has_reconstruction_stages<
+    FULL_CHAIN_ALG,
+    std::void_t<decltype(&FULL_CHAIN_ALG::clusterize),
+                decltype(&FULL_CHAIN_ALG::seed),
+                decltype(&FULL_CHAIN_ALG::find_tracks),
+                decltype(&FULL_CHAIN_ALG::fit_tracks),
+                decltype(&FULL_CHAIN_ALG::resolve_ambiguities)> >
+    : std::true_type {};
+
+/// One event travelling through the reconstruction pipeline
+template <typename FULL_CHAIN_ALG>
+struct pipeline_event {
+
+    /// Index of the algorithm processing the event
+    std::size_t slot = 0u;
+    /// The input data of the event
+    std::shared_ptr<const io::cell_reader_output> input;
+    /// The time at which the event entered the pipeline
+    std::chrono::high_resolution_clock::time_point start;
+
+    /// @name Outputs of the reconstruction stages
+    /// @{
+
+    /// The measurements of the event
+    std::optional<measurement_collection_types::host> measurements;
+    /// The estimated track parameters of the seeds
+    std::optional<bound_track_parameters_collection_types::host> track_params;
+    /// The (compact) track candidates
+    std::optional<compact_track_candidate_container_types::host>
+        track_candidates;
+    /// The fitted tracks
+    std::optional<typename FULL_CHAIN_ALG::output_type> track_states;
+
+    /// @}
+
+};  // struct pipeline_event
+
+}  // namespace details
+
+/// Process events in a pipeline of reconstruction stages
+///
+/// The events are read serially, in order, while the clusterization,
+/// seeding, track finding, track fitting and ambiguity resolution stages
+/// process different events in parallel. Every event in flight gets one of
+/// the algorithms for its exclusive use, so the number of algorithms sets the
+/// maximum number of events in flight.
+///
+/// @tparam FULL_CHAIN_ALG The type of the full chain algorithm to use
+/// @tparam EVENT_FUNC The type of the event provider function
+/// @param algs The full chain algorithms, one per pipeline token
+/// @param next_event Function returning the next event to process, as a
+///                   @c std::shared_ptr<const io::cell_reader_output>, or a
+///                   null pointer once there are no more events
+/// @param times Timing information to record the event latencies into
+/// @return The number of reconstructed tracks
+///
+template <typename FULL_CHAIN_ALG, typename EVENT_FUNC>
+std::size_t process_pipeline(const std::vector<FULL_CHAIN_ALG>& algs,
+                             EVENT_FUNC&& next_event,
+                             performance::timing_info& times) {
+
+    static_assert(details::has_reconstruction_stages<FULL_CHAIN_ALG>::value,
+                  "The algorithm does not provide the reconstruction stages");
+
+    using event_ptr = std::shared_ptr<details::pipeline_event<FULL_CHAIN_ALG> >;
+    using clock = std::chrono::high_resolution_clock;
+
+    // The algorithms not used by any event in flight.
+    tbb::concurrent_queue<std::size_t> free_slots;
+    for (std::size_t i = 0; i < algs.size(); ++i) {
+        free_slots.push(i);
+    }
+
+    // The number of reconstructed tracks.
+    std::atomic_size_t n_tracks = 0;
+
+    // Read the events.
+    auto read = [&](tbb::flow_control& fc) -> event_ptr {
+        std::shared_ptr<const io::cell_reader_output> input = next_event();
+        if (!input) {
+            fc.stop();
+            return nullptr;
+        }
+        auto event =
+            std::make_shared<details::pipeline_event<FULL_CHAIN_ALG> >();
+        event->input = std::move(input);
+        event->start = clock::now();
+        // The pipeline never has more events in flight than algorithms.
+        [[maybe_unused]] const bool found_slot =
+            free_slots.try_pop(event->slot);
+        assert(found_slot);
+        return event;
+    };
+
+    // Run the clusterization.
+    auto clusterize = [&](event_ptr event) {
+        event->measurements.emplace(algs[event->slot].clusterize(
+            event->input->cells, event->input->modules));
+        return event;
+    };
+
+    // Run the seeding.
+    auto seed = [&](event_ptr event) {
+        event->track_params.emplace(algs[event->slot].seed(
+            *(event->measurements), event->input->modules));
+        return event;
+    };
+
+    // Run the track finding.
+    auto find = [&](event_ptr event) {
+        event->track_candidates.emplace(algs[event->slot].find_tracks(
+            *(event->measurements), *(event->track_params)));
+        event->track_params.reset();
+        return event;
+    };
+
+    // Run the track fitting.
+    auto fit = [&](event_ptr event) {
+        event->track_states.emplace(algs[event->slot].fit_tracks(
+            *(event->track_candidates), *(event->measurements)));
+        event->track_candidates.reset();
+        return event;
+    };
+
+    // Run the ambiguity resolution, and release the algorithm of the event.
+    auto resolve = [&](event_ptr event) {
+        n_tracks.fetch_add(
+            algs[event->slot]
+                .resolve_ambiguities(*(event->track_states),
+                                     *(event->measurements))
+                .size());
+        times.record_latency("Event", clock::now() - event->start);
+
+        // Free the memory of the event before another event could use the
+        // same algorithm (and memory resource).
+        const std::size_t slot = event->slot;
+        event.reset();
+        free_slots.push(slot);
+    };
+
+    tbb::parallel_pipeline(
+        algs.size(),
+        tbb::make_filter<void, event_ptr>(tbb::filter_mode::serial_in_order,
+                                          read) &
+            tbb::make_filter<event_ptr, event_ptr>(tbb::filter_mode::parallel,
+                                                   clusterize) &
+            tbb::make_filter<event_ptr, event_ptr>(tbb::filter_mode::parallel,
+                                                   seed) &
+            tbb::make_filter<event_ptr, event_ptr>(tbb::filter_mode::parallel,
+                                                   find) &
+            tbb::make_filter<event_ptr, event_ptr>(tbb::filter_mode::parallel,
+                                                   fit) &
+            tbb::make_filter<event_ptr, void>(tbb::filter_mode::parallel,
+                                              resolve));
+
+    return n_tracks.load();
+}
+
+}  // namespace traccc
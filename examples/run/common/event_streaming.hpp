@@ -0,0 +1,93 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Command line option include(s).
+#include "traccc/options/detector.hpp"
+#include "traccc/options/detector_cache.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/throughput.hpp"
+
+// I/O include(s).
+#include "traccc/io/event_source.hpp"
+
+// Performance measurement include(s).
+#include "traccc/performance/timing_info.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace traccc {
+
+/// Create an event source for a throughput test
+///
+/// The event files of the input directory are replayed until @c events
+/// events were produced.
+///
+/// @param detector_opts The detector options of the application
+/// @param cache_opts The detector cache options of the application
+/// @param input_opts The input data options of the application
+/// @param throughput_opts The throughput options of the application
+/// @param events The number of events to produce
+/// @param mr The (thread safe) memory resource to read the events with
+/// @param start_reading Whether to start reading events right away
+/// @return The event source, with its detector description set up
+///
+inline std::unique_ptr<io::event_source> make_event_source(
+    const opts::detector& detector_opts, const opts::detector_cache& cache_opts,
+    const opts::input_data& input_opts, const opts::throughput& throughput_opts,
+    std::size_t events, vecmem::memory_resource& mr,
+    bool start_reading = true) {
+
+    io::event_source::config cfg;
+    cfg.directory = input_opts.directory;
+    cfg.detector_file = detector_opts.detector_file;
+    cfg.digitization_file = detector_opts.digitization_file;
+    cfg.event_format = input_opts.format;
+    cfg.geometry_format =
+        (detector_opts.use_detray_detector ? traccc::data_format::json
+                                           : traccc::data_format::csv);
+    cfg.detector_cache_file = cache_opts.cache_file;
+    cfg.input_events = input_opts.events;
+    cfg.events = events;
+    cfg.prefetch = throughput_opts.prefetch_events;
+    cfg.reader_threads = throughput_opts.reader_threads;
+    cfg.start_reading = start_reading;
+    return std::make_unique<io::event_source>(cfg, mr);
+}
+
+/// Remove the time spent waiting for input from a time measurement
+///
+/// The waiting time is recorded separately, as "Input waiting".
+///
+/// @param times The timing information to modify
+/// @param timer_name The name of the measurement to remove the time from
+/// @param wait_time The time spent waiting for input
+///
+inline void exclude_input_wait(performance::timing_info& times,
+                               std::string_view timer_name,
+                               std::chrono::nanoseconds wait_time) {
+
+    auto pos = std::find_if(times.data.begin(), times.data.end(),
+                            [timer_name](const auto& element) {
+                                return element.first == timer_name;
+                            });
+    if (pos != times.data.end()) {
+        pos->second -= std::min(wait_time, pos->second);
+    }
+    times.data.push_back({"Input waiting", wait_time});
+}
+
+}  // namespace traccc
@@ -0,0 +1,46 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Performance measurement include(s).
+#include "traccc/performance/timing_info.hpp"
+
+// System include(s).
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace traccc {
+
+/// Write the latency histograms of a throughput test next to its log file
+///
+/// For a log file called <tt>name.ext</tt>, the latencies are written into
+/// <tt>name_latency.json</tt> (overwriting it), and appended to
+/// <tt>name_latency.csv</tt>.
+///
+/// @param log_file The name of the throughput test's log file
+/// @param times The timing information holding the latency histograms
+/// @param csv_prefix Columns to write at the beginning of every CSV line
+///
+inline void write_latency_logs(std::string_view log_file,
+                               const performance::timing_info& times,
+                               std::string_view csv_prefix) {
+
+    const std::filesystem::path log_path{std::string{log_file}};
+    const std::string stem = log_path.stem().string() + "_latency";
+
+    std::ofstream json_file{log_path.parent_path() / (stem + ".json")};
+    performance::write_latencies_json(json_file, times);
+
+    std::ofstream csv_file{log_path.parent_path() / (stem + ".csv"),
+                           std::fstream::app};
+    performance::write_latencies_csv(csv_file, times, csv_prefix);
+}
+
+}  // namespace traccc
@@ -7,9 +7,15 @@
 
 #pragma once
 
+// Local include(s).
+#include "event_pipeline.hpp"
+#include "event_streaming.hpp"
+#include "latency_output.hpp"
+
 // Command line option include(s).
 #include "traccc/options/clusterization.hpp"
 #include "traccc/options/detector.hpp"
+#include "traccc/options/detector_cache.hpp"
 #include "traccc/options/input_data.hpp"
 #include "traccc/options/program_options.hpp"
 #include "traccc/options/threading.hpp"
@@ -21,7 +27,6 @@
 // I/O include(s).
 #include "traccc/io/demonstrator_edm.hpp"
 #include "traccc/io/read.hpp"
-#include "traccc/io/read_geometry.hpp"
 #include "traccc/io/utils.hpp"
 
 // Performance measurement include(s).
@@ -43,11 +48,15 @@
 
 // System include(s).
 #include <atomic>
+#include <condition_variable>
 #include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace traccc {
@@ -58,6 +67,7 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
 
     // Program options.
     opts::detector detector_opts;
+    opts::detector_cache cache_opts;
     opts::input_data input_opts;
     opts::clusterization clusterization_opts;
     opts::track_seeding seeding_opts;
@@ -67,11 +77,19 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
     opts::threading threading_opts;
     opts::program_options program_opts{
         description,
-        {detector_opts, input_opts, clusterization_opts, seeding_opts,
-         finding_opts, propagation_opts, throughput_opts, threading_opts},
+        {detector_opts, cache_opts, input_opts, clusterization_opts,
+         seeding_opts, finding_opts, propagation_opts, throughput_opts,
+         threading_opts},
         argc,
         argv};
 
+    // Check whether the pipeline mode can be used with this algorithm.
+    if (throughput_opts.pipeline &&
+        !details::has_reconstruction_stages<FULL_CHAIN_ALG>::value) {
+        throw std::invalid_argument(
+            "The pipeline mode is not supported by this algorithm");
+    }
+
     // Set up the timing info holder.
     performance::timing_info times;
 
@@ -85,11 +103,7 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
     // Memory resource to use in the test.
     HOST_MR uncached_host_mr;
 
-    // Read in the geometry.
-    auto [surface_transforms, barcode_map] = traccc::io::read_geometry(
-        detector_opts.detector_file,
-        (detector_opts.use_detray_detector ? traccc::data_format::json
-                                           : traccc::data_format::csv));
+    // Set up the detray detector, if needed.
     using detector_type = detray::detector<detray::default_metadata,
                                            detray::host_container_types>;
     detector_type detector{uncached_host_mr};
@@ -113,10 +127,10 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
         detector = std::move(det.first);
     }
 
-    // Read in all input events into memory.
+    // Read in all input events into memory, unless they are to be streamed.
     demonstrator_input input(&uncached_host_mr);
 
-    {
+    if (throughput_opts.stream_events == false) {
         performance::timer t{"File reading", times};
         // Create empty inputs using the correct memory resource
         for (std::size_t i = 0; i < input_opts.events; ++i) {
@@ -128,13 +142,23 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
             detector_opts.detector_file, detector_opts.digitization_file,
             input_opts.format,
             (detector_opts.use_detray_detector ? traccc::data_format::json
-                                               : traccc::data_format::csv));
+                                               : traccc::data_format::csv),
+            cache_opts.cache_file);
     }
 
+    // The number of algorithm instances to use. One for each thread, or in
+    // pipeline mode, one for each event in flight.
+    const std::size_t n_algs =
+        (throughput_opts.pipeline
+             ? (throughput_opts.pipeline_tokens != 0u
+                    ? throughput_opts.pipeline_tokens
+                    : 2u * threading_opts.threads)
+             : threading_opts.threads + 1);
+
     // Set up cached memory resources on top of the host memory resource
-    // separately for each CPU thread.
+    // separately for each algorithm instance.
     std::vector<std::unique_ptr<vecmem::binary_page_memory_resource> >
-        cached_host_mrs{threading_opts.threads + 1};
+        cached_host_mrs{n_algs};
 
     // Algorithm configuration(s).
     typename FULL_CHAIN_ALG::finding_algorithm::config_type finding_cfg;
@@ -155,10 +179,10 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
     typename FULL_CHAIN_ALG::fitting_algorithm::config_type fitting_cfg;
     fitting_cfg.propagation = propagation_opts.config;
 
-    // Set up the full-chain algorithm(s). One for each thread.
+    // Set up the full-chain algorithm(s).
     std::vector<FULL_CHAIN_ALG> algs;
-    algs.reserve(threading_opts.threads + 1);
-    for (std::size_t i = 0; i < threading_opts.threads + 1; ++i) {
+    algs.reserve(n_algs);
+    for (std::size_t i = 0; i < n_algs; ++i) {
 
         cached_host_mrs.at(i) =
             std::make_unique<vecmem::binary_page_memory_resource>(
@@ -176,7 +200,8 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
              seeding_opts.seedfilter,
              finding_cfg,
              fitting_cfg,
-             (detector_opts.use_detray_detector ? &detector : nullptr)});
+             (detector_opts.use_detray_detector ? &detector : nullptr),
+             (throughput_opts.stage_latencies ? &times : nullptr)});
     }
 
     // Seed the random number generator.
@@ -186,14 +211,47 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
     // optimisations don't skip any step
     std::atomic_size_t rec_track_params = 0;
 
-    // Cold Run events. To discard any "initialisation issues" in the
-    // measurements.
-    {
-        // Measure the time of execution.
-        performance::timer t{"Warm-up processing", times};
+    // Helper function processing one event on the current thread, measuring
+    // its latency.
+    auto process_event = [&](const io::cell_reader_output& event) {
+        performance::latency_timer t{"Event", times};
+        rec_track_params.fetch_add(
+            algs.at(tbb::this_task_arena::current_thread_index())(
+                    event.cells, event.modules)
+                .size());
+    };
+
+    // Helper function processing events in a pipeline of reconstruction
+    // stages, taking them from an event provider function.
+    auto process_pipeline_events = [&](auto&& next_event) {
+        if constexpr (details::has_reconstruction_stages<
+                          FULL_CHAIN_ALG>::value) {
+            arena.execute([&]() {
+                rec_track_params.fetch_add(
+                    process_pipeline(algs, next_event, times));
+            });
+        }
+    };
+
+    // Helper function processing randomly chosen events from the input
+    // loaded into memory.
+    auto process_input = [&](std::size_t n_events) {
+        if (throughput_opts.pipeline) {
+            std::size_t n_read = 0u;
+            process_pipeline_events(
+                [&]() -> std::shared_ptr<const io::cell_reader_output> {
+                    if (n_read == n_events) {
+                        return nullptr;
+                    }
+                    ++n_read;
+                    // The events are owned by the input vector.
+                    return {std::shared_ptr<const void>{},
+                            &input[std::rand() % input_opts.events]};
+                });
+            return;
+        }
 
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
+        for (std::size_t i = 0; i < n_events; ++i) {
 
             // Choose which event to process.
             const std::size_t event = std::rand() % input_opts.events;
@@ -201,44 +259,126 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
             // Launch the processing of the event.
             arena.execute([&, event]() {
                 group.run([&, event]() {
-                    rec_track_params.fetch_add(
-                        algs.at(tbb::this_task_arena::current_thread_index())(
-                                input[event].cells, input[event].modules)
-                            .size());
+                    process_event(input[event]);
                 });
             });
         }
 
         // Wait for all tasks to finish.
         group.wait();
-    }
+    };
+
+    // Helper function processing all events of an event source. Limiting the
+    // number of events in flight to the number of threads, so that the
+    // memory use is bounded by the event source.
+    std::mutex in_flight_mutex;
+    std::condition_variable in_flight_cond;
+    std::size_t in_flight = 0u;
+    auto process_source = [&](io::event_source& source) {
+        if (throughput_opts.pipeline) {
+            process_pipeline_events([&]() { return source.next(); });
+            return;
+        }
 
-    // Reset the dummy counter.
-    rec_track_params = 0;
+        while (true) {
 
-    {
-        // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
-
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.processed_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
+            // Wait for a thread to become available.
+            {
+                std::unique_lock lock(in_flight_mutex);
+                in_flight_cond.wait(lock, [&]() {
+                    return in_flight < threading_opts.threads;
+                });
+            }
+
+            // Get the next event.
+            std::shared_ptr<const io::event_source::event_type> event =
+                source.next();
+            if (!event) {
+                break;
+            }
+            {
+                std::lock_guard lock(in_flight_mutex);
+                ++in_flight;
+            }
 
             // Launch the processing of the event.
             arena.execute([&, event]() {
                 group.run([&, event]() {
-                    rec_track_params.fetch_add(
-                        algs.at(tbb::this_task_arena::current_thread_index())(
-                                input[event].cells, input[event].modules)
-                            .size());
+                    process_event(*event);
+                    {
+                        std::lock_guard lock(in_flight_mutex);
+                        --in_flight;
+                    }
+                    in_flight_cond.notify_one();
                 });
             });
         }
 
         // Wait for all tasks to finish.
         group.wait();
+    };
+
+    // Cold Run events. To discard any "initialisation issues" in the
+    // measurements.
+    if (throughput_opts.stream_events) {
+        // Measure the time of execution.
+        performance::timer t{"Warm-up processing", times};
+
+        // Process the events of an event source.
+        auto source = make_event_source(detector_opts, cache_opts,
+                                        input_opts, throughput_opts,
+                                        throughput_opts.cold_run_events,
+                                        uncached_host_mr);
+        process_source(*source);
+    } else {
+        // Measure the time of execution.
+        performance::timer t{"Warm-up processing", times};
+
+        // Process the requested number of events.
+        process_input(throughput_opts.cold_run_events);
+    }
+
+    // Reset the dummy counter, and the latency measurements.
+    rec_track_params = 0;
+    times.reset_latencies();
+
+    if (throughput_opts.stream_events) {
+
+        // Set up the event source (and the detector description that it
+        // needs) before starting the clock, without reading any events yet.
+        std::unique_ptr<io::event_source> source = make_event_source(
+            detector_opts, cache_opts, input_opts, throughput_opts,
+            throughput_opts.processed_events, uncached_host_mr, false);
+
+        // When excluding I/O from the measurement, let the event source fill
+        // its prefetch queue before starting the clock.
+        if (throughput_opts.io_inclusive == false) {
+            source->wait_for_prefetch();
+        }
+
+        {
+            // Measure the total time of execution.
+            performance::timer t{"Event processing", times};
+
+            // Start reading the events, if that did not happen yet.
+            source->start();
+
+            // Process all events of the source.
+            process_source(*source);
+        }
+
+        // Remove the time spent waiting for input, if requested. This is the
+        // time during which at least one thread was idle, waiting for input.
+        if (throughput_opts.io_inclusive == false) {
+            exclude_input_wait(times, "Event processing",
+                               source->wait_time());
+        }
+    } else {
+        // Measure the total time of execution.
+        performance::timer t{"Event processing", times};
+
+        // Process the requested number of events.
+        process_input(throughput_opts.processed_events);
     }
 
     // Delete the algorithms and host memory caches explicitly before their
@@ -258,6 +398,9 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
               << performance::throughput{throughput_opts.processed_events,
                                          times, "Event processing"}
               << std::endl;
+    std::cout << "Latencies:" << std::endl;
+    performance::print_latencies(std::cout, times);
+    std::cout << std::endl;
 
     // Print results to log file
     if (throughput_opts.log_file != "\0") {
@@ -271,6 +414,11 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
                 << times.get_time("Warm-up processing").count() << ","
                 << times.get_time("Event processing").count() << std::endl;
         logFile.close();
+
+        // Write the latencies next to the log file.
+        write_latency_logs(throughput_opts.log_file, times,
+                           "\"" + input_opts.directory + "\"," +
+                               std::to_string(threading_opts.threads) + ",");
     }
 
     // Return gracefully.
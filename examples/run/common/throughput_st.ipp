@@ -7,9 +7,14 @@
 
 #pragma once
 
+// Local include(s).
+#include "event_streaming.hpp"
+#include "latency_output.hpp"
+
 // Command line option include(s).
 #include "traccc/options/clusterization.hpp"
 #include "traccc/options/detector.hpp"
+#include "traccc/options/detector_cache.hpp"
 #include "traccc/options/input_data.hpp"
 #include "traccc/options/program_options.hpp"
 #include "traccc/options/throughput.hpp"
@@ -20,7 +25,6 @@
 // I/O include(s).
 #include "traccc/io/demonstrator_edm.hpp"
 #include "traccc/io/read.hpp"
-#include "traccc/io/read_geometry.hpp"
 #include "traccc/io/utils.hpp"
 
 // Performance measurement include(s).
@@ -49,6 +53,7 @@ int throughput_st(std::string_view description, int argc, char* argv[],
 
     // Program options.
     opts::detector detector_opts;
+    opts::detector_cache cache_opts;
     opts::input_data input_opts;
     opts::clusterization clusterization_opts;
     opts::track_seeding seeding_opts;
@@ -57,8 +62,8 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     opts::throughput throughput_opts;
     opts::program_options program_opts{
         description,
-        {detector_opts, input_opts, clusterization_opts, seeding_opts,
-         finding_opts, propagation_opts, throughput_opts},
+        {detector_opts, cache_opts, input_opts, clusterization_opts,
+         seeding_opts, finding_opts, propagation_opts, throughput_opts},
         argc,
         argv};
 
@@ -70,11 +75,7 @@ int throughput_st(std::string_view description, int argc, char* argv[],
     std::unique_ptr<vecmem::binary_page_memory_resource> cached_host_mr =
         std::make_unique<vecmem::binary_page_memory_resource>(uncached_host_mr);
 
-    // Read in the geometry.
-    auto [surface_transforms, barcode_map] = traccc::io::read_geometry(
-        detector_opts.detector_file,
-        (detector_opts.use_detray_detector ? traccc::data_format::json
-                                           : traccc::data_format::csv));
+    // Set up the detray detector, if needed.
     using detector_type = detray::detector<detray::default_metadata,
                                            detray::host_container_types>;
     detector_type detector{uncached_host_mr};
@@ -103,10 +104,10 @@ int throughput_st(std::string_view description, int argc, char* argv[],
             ? static_cast<vecmem::memory_resource&>(*cached_host_mr)
             : static_cast<vecmem::memory_resource&>(uncached_host_mr);
 
-    // Read in all input events into memory.
+    // Read in all input events into memory, unless they are to be streamed.
     demonstrator_input input(&uncached_host_mr);
 
-    {
+    if (throughput_opts.stream_events == false) {
         performance::timer t{"File reading", times};
         // Create empty inputs using the correct memory resource
         for (std::size_t i = 0; i < input_opts.events; ++i) {
@@ -118,7 +119,8 @@ int throughput_st(std::string_view description, int argc, char* argv[],
             detector_opts.detector_file, detector_opts.digitization_file,
             input_opts.format,
             (detector_opts.use_detray_detector ? traccc::data_format::json
-                                               : traccc::data_format::csv));
+                                               : traccc::data_format::csv),
+            cache_opts.cache_file);
     }
 
     // Algorithm configuration(s).
@@ -146,7 +148,14 @@ int throughput_st(std::string_view description, int argc, char* argv[],
         seeding_opts.seedfinder,
         spacepoint_grid_config{seeding_opts.seedfinder},
         seeding_opts.seedfilter, finding_cfg, fitting_cfg,
-        (detector_opts.use_detray_detector ? &detector : nullptr));
+        (detector_opts.use_detray_detector ? &detector : nullptr),
+        (throughput_opts.stage_latencies ? &times : nullptr));
+
+    // Helper function processing one event, measuring its latency.
+    auto process_event = [&](const io::cell_reader_output& event) {
+        performance::latency_timer t{"Event", times};
+        return (*alg)(event.cells, event.modules).size();
+    };
 
     // Seed the random number generator.
     std::srand(std::time(0));
@@ -161,22 +170,67 @@ int throughput_st(std::string_view description, int argc, char* argv[],
         // Measure the time of execution.
         performance::timer t{"Warm-up processing", times};
 
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
+        if (throughput_opts.stream_events) {
 
-            // Choose which event to process.
-            const std::size_t event = std::rand() % input_opts.events;
+            // Process the events of an event source.
+            auto source = make_event_source(detector_opts, cache_opts,
+                                            input_opts, throughput_opts,
+                                            throughput_opts.cold_run_events,
+                                            uncached_host_mr);
+            while (auto event = source->next()) {
+                rec_track_params += process_event(*event);
+            }
+        } else {
 
-            // Process one event.
-            rec_track_params +=
-                (*alg)(input[event].cells, input[event].modules).size();
+            // Process the requested number of events.
+            for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
+
+                // Choose which event to process.
+                const std::size_t event = std::rand() % input_opts.events;
+
+                // Process one event.
+                rec_track_params += process_event(input[event]);
+            }
         }
     }
 
-    // Reset the dummy counter.
+    // Reset the dummy counter, and the latency measurements.
     rec_track_params = 0;
+    times.reset_latencies();
 
-    {
+    if (throughput_opts.stream_events) {
+
+        // Set up the event source (and the detector description that it
+        // needs) before starting the clock, without reading any events yet.
+        std::unique_ptr<io::event_source> source = make_event_source(
+            detector_opts, cache_opts, input_opts, throughput_opts,
+            throughput_opts.processed_events, uncached_host_mr, false);
+
+        // When excluding I/O from the measurement, let the event source fill
+        // its prefetch queue before starting the clock.
+        if (throughput_opts.io_inclusive == false) {
+            source->wait_for_prefetch();
+        }
+
+        {
+            // Measure the total time of execution.
+            performance::timer t{"Event processing", times};
+
+            // Start reading the events, if that did not happen yet.
+            source->start();
+
+            // Process all events of the source.
+            while (auto event = source->next()) {
+                rec_track_params += process_event(*event);
+            }
+        }
+
+        // Remove the time spent waiting for input, if requested.
+        if (throughput_opts.io_inclusive == false) {
+            exclude_input_wait(times, "Event processing",
+                               source->wait_time());
+        }
+    } else {
         // Measure the total time of execution.
         performance::timer t{"Event processing", times};
 
@@ -187,8 +241,7 @@ int throughput_st(std::string_view description, int argc, char* argv[],
             const std::size_t event = std::rand() % input_opts.events;
 
             // Process one event.
-            rec_track_params +=
-                (*alg)(input[event].cells, input[event].modules).size();
+            rec_track_params += process_event(input[event]);
         }
     }
 
@@ -208,6 +261,15 @@ int throughput_st(std::string_view description, int argc, char* argv[],
               << performance::throughput{throughput_opts.processed_events,
                                          times, "Event processing"}
               << std::endl;
+    std::cout << "Latencies:" << std::endl;
+    performance::print_latencies(std::cout, times);
+    std::cout << std::endl;
+
+    // Write the latencies next to the log file.
+    if (throughput_opts.log_file.empty() == false) {
+        write_latency_logs(throughput_opts.log_file, times,
+                           "\"" + input_opts.directory + "\",1,");
+    }
 
     // Return gracefully.
     return 0;
@@ -8,8 +8,29 @@
 // Local include(s).
 #include "full_chain_algorithm.hpp"
 
+// Project include(s).
+#include "traccc/performance/timer.hpp"
+
 namespace traccc {
 
+namespace {
+
+/// Configuration for the ambiguity resolution of the full chain
+///
+/// The throughput measurements should neither pay for the validation of the
+/// results, nor for printing diagnostics about every event.
+///
+greedy_ambiguity_resolution_algorithm::config_t ambiguity_resolution_config() {
+
+    greedy_ambiguity_resolution_algorithm::config_t config;
+    config.check_obvious_errs = false;
+    config.verbose_error = false;
+    config.verbose_warning = false;
+    return config;
+}
+
+}  // namespace
+
 full_chain_algorithm::full_chain_algorithm(
     vecmem::memory_resource& mr, unsigned int,
     const seedfinder_config& finder_config,
@@ -17,16 +38,18 @@ full_chain_algorithm::full_chain_algorithm(
     const seedfilter_config& filter_config,
     const finding_algorithm::config_type& finding_config,
     const fitting_algorithm::config_type& fitting_config,
-    detector_type* detector)
+    detector_type* detector, performance::timing_info* timing)
     : m_field_vec{0.f, 0.f, finder_config.bFieldInZ},
       m_field(detray::bfield::create_const_field(m_field_vec)),
       m_detector(detector),
+      m_timing(timing),
       m_clusterization(mr),
       m_spacepoint_formation(mr),
       m_seeding(finder_config, grid_config, filter_config, mr),
       m_track_parameter_estimation(mr),
       m_finding(finding_config),
       m_fitting(fitting_config),
+      m_ambiguity_resolution(ambiguity_resolution_config()),
       m_finder_config(finder_config),
       m_grid_config(grid_config),
       m_filter_config(filter_config),
@@ -39,23 +62,26 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
 
     // Run the clusterization.
     const host::clusterization_algorithm::output_type measurements =
-        m_clusterization(vecmem::get_data(cells), vecmem::get_data(modules));
+        clusterize(cells, modules);
 
     // Run the seed-finding.
-    const host::spacepoint_formation_algorithm::output_type spacepoints =
-        m_spacepoint_formation(vecmem::get_data(measurements),
-                               vecmem::get_data(modules));
     const track_params_estimation::output_type track_params =
-        m_track_parameter_estimation(spacepoints, m_seeding(spacepoints),
-                                     m_field_vec);
+        seed(measurements, modules);
 
-    // If we have a Detray detector, run the track finding and fitting.
+    // If we have a Detray detector, run the track finding, fitting and
+    // ambiguity resolution.
     if (m_detector != nullptr) {
 
-        // Return the final container, after track finding and fitting.
-        return m_fitting(
-            *m_detector, m_field,
-            m_finding(*m_detector, m_field, measurements, track_params));
+        // Run the track finding.
+        const compact_track_candidate_container_types::host track_candidates =
+            find_tracks(measurements, track_params);
+
+        // Run the track fitting.
+        const output_type track_states =
+            fit_tracks(track_candidates, measurements);
+
+        // Return the final container, after ambiguity resolution.
+        return resolve_ambiguities(track_states, measurements);
 
     }
     // If not, just return an empty object.
@@ -66,4 +92,92 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
     }
 }
 
+host::clusterization_algorithm::output_type full_chain_algorithm::clusterize(
+    const cell_collection_types::host& cells,
+    const cell_module_collection_types::host& modules) const {
+
+    // Measure the latency of the stage, if requested.
+    performance::stage_timer stages{m_timing};
+
+    host::clusterization_algorithm::output_type measurements =
+        m_clusterization(vecmem::get_data(cells), vecmem::get_data(modules));
+    stages.next("Clusterization");
+    return measurements;
+}
+
+track_params_estimation::output_type full_chain_algorithm::seed(
+    const measurement_collection_types::host& measurements,
+    const cell_module_collection_types::host& modules) const {
+
+    // Measure the latencies of the individual stages, if requested.
+    performance::stage_timer stages{m_timing};
+
+    // The seeding only needs the positions of the spacepoints, so use the
+    // slim ones, which refer to the measurements by index.
+    const slim_spacepoint_collection_types::host spacepoints =
+        m_spacepoint_formation.form_slim(vecmem::get_data(measurements),
+                                         vecmem::get_data(modules));
+    stages.next("Spacepoint formation");
+    const seeding_algorithm::output_type seeds = m_seeding(spacepoints);
+    stages.next("Seeding");
+    track_params_estimation::output_type track_params =
+        m_track_parameter_estimation(spacepoints, measurements, seeds,
+                                     m_field_vec);
+    stages.next("Track parameter estimation");
+    return track_params;
+}
+
+compact_track_candidate_container_types::host
+full_chain_algorithm::find_tracks(
+    const measurement_collection_types::host& measurements,
+    const bound_track_parameters_collection_types::host& track_params) const {
+
+    if (m_detector == nullptr) {
+        return {};
+    }
+
+    // Measure the latency of the stage, if requested.
+    performance::stage_timer stages{m_timing};
+
+    compact_track_candidate_container_types::host track_candidates =
+        m_finding.find_compact(*m_detector, m_field, measurements,
+                               track_params);
+    stages.next("Track finding");
+    return track_candidates;
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::fit_tracks(
+    const compact_track_candidate_container_types::host& track_candidates,
+    const measurement_collection_types::host& measurements) const {
+
+    if (m_detector == nullptr) {
+        return {};
+    }
+
+    // Measure the latency of the stage, if requested.
+    performance::stage_timer stages{m_timing};
+
+    output_type track_states = m_fitting.fit_compact(
+        *m_detector, m_field, track_candidates, measurements);
+    stages.next("Track fitting");
+    return track_states;
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::resolve_ambiguities(
+    const output_type& track_states,
+    const measurement_collection_types::host& measurements) const {
+
+    if (m_detector == nullptr) {
+        return {};
+    }
+
+    // Measure the latency of the stage, if requested.
+    performance::stage_timer stages{m_timing};
+
+    output_type resolved_track_states =
+        m_ambiguity_resolution(track_states, measurements);
+    stages.next("Ambiguity resolution");
+    return resolved_track_states;
+}
+
 }  // namespace traccc
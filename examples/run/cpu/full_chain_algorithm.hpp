@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 #include "traccc/clusterization/spacepoint_formation_algorithm.hpp"
 #include "traccc/edm/cell.hpp"
@@ -15,6 +16,7 @@
 #include "traccc/finding/finding_algorithm.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/performance/timing_info.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 #include "traccc/utils/algorithm.hpp"
@@ -35,9 +37,10 @@ namespace traccc {
 ///
 /// At least as much as is implemented in the project at any given moment.
 ///
-class full_chain_algorithm : public algorithm<track_state_container_types::host(
-                                 const cell_collection_types::host&,
-                                 const cell_module_collection_types::host&)> {
+class full_chain_algorithm
+    : public algorithm<compact_track_state_container_types::host(
+          const cell_collection_types::host&,
+          const cell_module_collection_types::host&)> {
 
     public:
     /// @name Type declaration(s)
@@ -70,6 +73,8 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
     ///           objects
     /// @param dummy This is not used anywhere. Allows templating CPU/Device
     /// algorithm.
+    /// @param timing Timing information to record the latencies of the
+    ///               individual reconstruction stages into (optional)
     ///
     full_chain_algorithm(vecmem::memory_resource& mr, unsigned int dummy,
                          const seedfinder_config& finder_config,
@@ -77,7 +82,8 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
                          const seedfilter_config& filter_config,
                          const finding_algorithm::config_type& finding_config,
                          const fitting_algorithm::config_type& fitting_config,
-                         detector_type* detector);
+                         detector_type* detector,
+                         performance::timing_info* timing = nullptr);
 
     /// Reconstruct track parameters in the entire detector
     ///
@@ -88,6 +94,69 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
         const cell_collection_types::host& cells,
         const cell_module_collection_types::host& modules) const override;
 
+    /// @name Reconstruction stages
+    ///
+    /// The steps of @c operator(), which can also be run one by one. For
+    /// instance by different tasks of a pipeline.
+    ///
+    /// @{
+
+    /// Run the clusterization
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param modules The detector modules of the event
+    /// @return The measurements of the event
+    ///
+    host::clusterization_algorithm::output_type clusterize(
+        const cell_collection_types::host& cells,
+        const cell_module_collection_types::host& modules) const;
+
+    /// Run the spacepoint formation, seeding and track parameter estimation
+    ///
+    /// @param measurements The measurements of the event
+    /// @param modules The detector modules of the event
+    /// @return The estimated track parameters of the seeds
+    ///
+    track_params_estimation::output_type seed(
+        const measurement_collection_types::host& measurements,
+        const cell_module_collection_types::host& modules) const;
+
+    /// Run the track finding
+    ///
+    /// @param measurements The measurements of the event
+    /// @param track_params The estimated track parameters of the seeds
+    /// @return The (compact) track candidates, or an empty container without
+    ///         a detector
+    ///
+    compact_track_candidate_container_types::host find_tracks(
+        const measurement_collection_types::host& measurements,
+        const bound_track_parameters_collection_types::host& track_params)
+        const;
+
+    /// Run the track fitting
+    ///
+    /// @param track_candidates The (compact) track candidates of the event
+    /// @param measurements The measurements of the event
+    /// @return The (compact) fitted tracks, or an empty container without a
+    ///         detector
+    ///
+    output_type fit_tracks(
+        const compact_track_candidate_container_types::host& track_candidates,
+        const measurement_collection_types::host& measurements) const;
+
+    /// Run the ambiguity resolution
+    ///
+    /// @param track_states The (compact) fitted tracks of the event
+    /// @param measurements The measurements of the event
+    /// @return The fitted tracks, without the ambiguous ones, or an empty
+    ///         container without a detector
+    ///
+    output_type resolve_ambiguities(
+        const output_type& track_states,
+        const measurement_collection_types::host& measurements) const;
+
+    /// @}
+
     private:
     /// Constant B field for the (seed) track parameter estimation
     traccc::vector3 m_field_vec;
@@ -97,6 +166,9 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
     /// Detector
     detector_type* m_detector;
 
+    /// Timing information for the reconstruction stages
+    performance::timing_info* m_timing;
+
     /// @name Sub-algorithms used by this full-chain algorithm
     /// @{
 
@@ -113,6 +185,8 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
     finding_algorithm m_finding;
     /// Track fitting algorithm
     fitting_algorithm m_fitting;
+    /// Ambiguity resolution algorithm
+    greedy_ambiguity_resolution_algorithm m_ambiguity_resolution;
 
     /// @}
 
@@ -6,9 +6,8 @@
  */
 
 // io
+#include "traccc/io/detector_cache.hpp"
 #include "traccc/io/read_cells.hpp"
-#include "traccc/io/read_digitization_config.hpp"
-#include "traccc/io/read_geometry.hpp"
 #include "traccc/io/utils.hpp"
 #include "traccc/io/write.hpp"
 
@@ -30,6 +29,7 @@
 // options
 #include "traccc/options/clusterization.hpp"
 #include "traccc/options/detector.hpp"
+#include "traccc/options/detector_cache.hpp"
 #include "traccc/options/input_data.hpp"
 #include "traccc/options/output_data.hpp"
 #include "traccc/options/performance.hpp"
@@ -61,6 +61,7 @@
 int seq_run(const traccc::opts::input_data& input_opts,
             const traccc::opts::output_data& output_opts,
             const traccc::opts::detector& detector_opts,
+            const traccc::opts::detector_cache& cache_opts,
             const traccc::opts::clusterization& /*clusterization_opts*/,
             const traccc::opts::track_seeding& seeding_opts,
             const traccc::opts::track_finding& finding_opts,
@@ -71,11 +72,17 @@ int seq_run(const traccc::opts::input_data& input_opts,
     // Memory resource used by the application.
     vecmem::host_memory_resource host_mr;
 
-    // Read in the geometry.
-    auto [surface_transforms, barcode_map] = traccc::io::read_geometry(
-        detector_opts.detector_file,
-        (detector_opts.use_detray_detector ? traccc::data_format::json
-                                           : traccc::data_format::csv));
+    // Read in the geometry and the digitization configuration.
+    const traccc::io::detector_description detector_desc =
+        traccc::io::read_detector_description(
+            detector_opts.detector_file, detector_opts.digitization_file,
+            (detector_opts.use_detray_detector ? traccc::data_format::json
+                                               : traccc::data_format::csv),
+            cache_opts.cache_file);
+    const traccc::geometry& surface_transforms =
+        detector_desc.surface_transforms;
+    const traccc::digitization_config& digi_cfg = detector_desc.digi_cfg;
+    const auto& barcode_map = detector_desc.barcode_map;
 
     using detector_type = detray::detector<detray::default_metadata,
                                            detray::host_container_types>;
@@ -99,10 +106,6 @@ int seq_run(const traccc::opts::input_data& input_opts,
         detector = std::move(det.first);
     }
 
-    // Read the digitization configuration file
-    auto digi_cfg =
-        traccc::io::read_digitization_config(detector_opts.digitization_file);
-
     // Output stats
     uint64_t n_cells = 0;
     uint64_t n_modules = 0;
@@ -369,6 +372,7 @@ int main(int argc, char* argv[]) {
 
     // Program options.
     traccc::opts::detector detector_opts;
+    traccc::opts::detector_cache cache_opts;
     traccc::opts::input_data input_opts;
     traccc::opts::output_data output_opts{traccc::data_format::obj, ""};
     traccc::opts::clusterization clusterization_opts;
@@ -379,14 +383,14 @@ int main(int argc, char* argv[]) {
     traccc::opts::performance performance_opts;
     traccc::opts::program_options program_opts{
         "Full Tracking Chain on the Host",
-        {detector_opts, input_opts, output_opts, clusterization_opts,
-         seeding_opts, finding_opts, propagation_opts, resolution_opts,
-         performance_opts},
+        {detector_opts, cache_opts, input_opts, output_opts,
+         clusterization_opts, seeding_opts, finding_opts, propagation_opts,
+         resolution_opts, performance_opts},
         argc,
         argv};
 
     // Run the application.
-    return seq_run(input_opts, output_opts, detector_opts, clusterization_opts,
-                   seeding_opts, finding_opts, propagation_opts,
-                   resolution_opts, performance_opts);
+    return seq_run(input_opts, output_opts, detector_opts, cache_opts,
+                   clusterization_opts, seeding_opts, finding_opts,
+                   propagation_opts, resolution_opts, performance_opts);
 }
@@ -8,12 +8,16 @@
 // Local include(s).
 #include "full_chain_algorithm.hpp"
 
+// Project include(s).
+#include "traccc/performance/timer.hpp"
+
 // CUDA include(s).
 #include <cuda_runtime_api.h>
 
 // System include(s).
 #include <iostream>
 #include <stdexcept>
+#include <string_view>
 
 /// Helper macro for checking the return value of CUDA function calls
 #define CUDA_ERROR_CHECK(EXP)                                                  \
@@ -35,7 +39,7 @@ full_chain_algorithm::full_chain_algorithm(
     const seedfilter_config& filter_config,
     const finding_algorithm::config_type& finding_config,
     const fitting_algorithm::config_type& fitting_config,
-    host_detector_type* detector)
+    host_detector_type* detector, performance::timing_info* timing)
     : m_host_mr(host_mr),
       m_stream(),
       m_device_mr(),
@@ -45,6 +49,7 @@ full_chain_algorithm::full_chain_algorithm(
       m_field_vec{0.f, 0.f, finder_config.bFieldInZ},
       m_field(detray::bfield::create_const_field(m_field_vec)),
       m_detector(detector),
+      m_timing(timing),
       m_target_cells_per_partition(target_cells_per_partition),
       m_clusterization(memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
                        m_stream, m_target_cells_per_partition),
@@ -95,6 +100,7 @@ full_chain_algorithm::full_chain_algorithm(const full_chain_algorithm& parent)
       m_field_vec(parent.m_field_vec),
       m_field(parent.m_field),
       m_detector(parent.m_detector),
+      m_timing(parent.m_timing),
       m_target_cells_per_partition(parent.m_target_cells_per_partition),
       m_clusterization(memory_resource{*m_cached_device_mr, &m_host_mr}, m_copy,
                        m_stream, m_target_cells_per_partition),
@@ -137,6 +143,16 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
     const cell_collection_types::host& cells,
     const cell_module_collection_types::host& modules) const {
 
+    // Measure the latencies of the individual stages, if requested. Waiting
+    // for the asynchronous operations to finish after every stage.
+    performance::stage_timer stages{m_timing};
+    auto next_stage = [&](std::string_view stage_name) {
+        if (stages.enabled()) {
+            m_stream.synchronize();
+            stages.next(stage_name);
+        }
+    };
+
     // Create device copy of input collections
     cell_collection_types::buffer cells_buffer(cells.size(),
                                                *m_cached_device_mr);
@@ -144,18 +160,23 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
     cell_module_collection_types::buffer modules_buffer(modules.size(),
                                                         *m_cached_device_mr);
     m_copy(vecmem::get_data(modules), modules_buffer)->ignore();
+    next_stage("Input copy");
 
     // Run the clusterization (asynchronously).
     const clusterization_algorithm::output_type measurements =
         m_clusterization(cells_buffer, modules_buffer);
     m_measurement_sorting(measurements);
+    next_stage("Clusterization");
 
     // Run the seed-finding (asynchronously).
     const spacepoint_formation_algorithm::output_type spacepoints =
         m_spacepoint_formation(measurements, modules_buffer);
+    next_stage("Spacepoint formation");
+    const seeding_algorithm::output_type seeds = m_seeding(spacepoints);
+    next_stage("Seeding");
     const track_params_estimation::output_type track_params =
-        m_track_parameter_estimation(spacepoints, m_seeding(spacepoints),
-                                     m_field_vec);
+        m_track_parameter_estimation(spacepoints, seeds, m_field_vec);
+    next_stage("Track parameter estimation");
 
     // If we have a Detray detector, run the track finding and fitting.
     if (m_detector != nullptr) {
@@ -171,15 +192,18 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
         const finding_algorithm::output_type track_candidates =
             m_finding(m_device_detector_view, m_field, navigation_buffer,
                       measurements, track_params);
+        next_stage("Track finding");
 
         // Run the track fitting (asynchronously).
         const fitting_algorithm::output_type track_states =
             m_fitting(m_device_detector_view, m_field, navigation_buffer,
                       track_candidates);
+        next_stage("Track fitting");
 
         // Copy a limited amount of result data back to the host.
         output_type result{&m_host_mr};
         m_copy(track_states.headers, result)->wait();
+        next_stage("Output copy");
         return result;
 
     }
@@ -19,6 +19,7 @@
 #include "traccc/edm/cell.hpp"
 #include "traccc/edm/track_state.hpp"
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/performance/timing_info.hpp"
 #include "traccc/utils/algorithm.hpp"
 
 // Detray include(s).
@@ -84,6 +85,9 @@ class full_chain_algorithm
     ///           objects
     /// @param target_cells_per_partition The average number of cells in each
     /// partition.
+    /// @param timing Timing information to record the latencies of the
+    ///               individual reconstruction stages into (optional). The
+    ///               stream is synchronised after every stage when it is set.
     ///
     full_chain_algorithm(vecmem::memory_resource& host_mr,
                          const unsigned short target_cells_per_partiton,
@@ -92,7 +96,8 @@ class full_chain_algorithm
                          const seedfilter_config& filter_config,
                          const finding_algorithm::config_type& finding_config,
                          const fitting_algorithm::config_type& fitting_config,
-                         host_detector_type* detector);
+                         host_detector_type* detector,
+                         performance::timing_info* timing = nullptr);
 
     /// Copy constructor
     ///
@@ -140,6 +145,9 @@ class full_chain_algorithm
     /// View of the detector's payload on the device
     host_detector_type::view_type m_device_detector_view;
 
+    /// Timing information for the reconstruction stages
+    performance::timing_info* m_timing;
+
     /// @name Sub-algorithms used by this full-chain algorithm
     /// @{
 
@@ -20,13 +20,13 @@
 #include "traccc/efficiency/seeding_performance_writer.hpp"
 #include "traccc/finding/finding_algorithm.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
+#include "traccc/io/detector_cache.hpp"
 #include "traccc/io/read_cells.hpp"
-#include "traccc/io/read_digitization_config.hpp"
-#include "traccc/io/read_geometry.hpp"
 #include "traccc/io/utils.hpp"
 #include "traccc/options/accelerator.hpp"
 #include "traccc/options/clusterization.hpp"
 #include "traccc/options/detector.hpp"
+#include "traccc/options/detector_cache.hpp"
 #include "traccc/options/input_data.hpp"
 #include "traccc/options/performance.hpp"
 #include "traccc/options/program_options.hpp"
@@ -60,6 +60,7 @@
 #include <memory>
 
 int seq_run(const traccc::opts::detector& detector_opts,
+            const traccc::opts::detector_cache& cache_opts,
             const traccc::opts::input_data& input_opts,
             const traccc::opts::clusterization& clusterization_opts,
             const traccc::opts::track_seeding& seeding_opts,
@@ -78,11 +79,17 @@ int seq_run(const traccc::opts::detector& detector_opts,
     traccc::cuda::stream stream;
     vecmem::cuda::async_copy copy{stream.cudaStream()};
 
-    // Read in the geometry.
-    auto [surface_transforms, barcode_map] = traccc::io::read_geometry(
-        detector_opts.detector_file,
-        (detector_opts.use_detray_detector ? traccc::data_format::json
-                                           : traccc::data_format::csv));
+    // Read in the geometry and the digitization configuration.
+    const traccc::io::detector_description detector_desc =
+        traccc::io::read_detector_description(
+            detector_opts.detector_file, detector_opts.digitization_file,
+            (detector_opts.use_detray_detector ? traccc::data_format::json
+                                               : traccc::data_format::csv),
+            cache_opts.cache_file);
+    const traccc::geometry& surface_transforms =
+        detector_desc.surface_transforms;
+    const traccc::digitization_config& digi_cfg = detector_desc.digi_cfg;
+    const auto& barcode_map = detector_desc.barcode_map;
 
     using host_detector_type = detray::detector<detray::default_metadata,
                                                 detray::host_container_types>;
@@ -118,10 +125,6 @@ int seq_run(const traccc::opts::detector& detector_opts,
         device_detector_view = detray::get_data(device_detector);
     }
 
-    // Read the digitization configuration file
-    auto digi_cfg =
-        traccc::io::read_digitization_config(detector_opts.digitization_file);
-
     // Output stats
     uint64_t n_cells = 0;
     uint64_t n_modules = 0;
@@ -542,6 +545,7 @@ int main(int argc, char* argv[]) {
 
     // Program options.
     traccc::opts::detector detector_opts;
+    traccc::opts::detector_cache cache_opts;
     traccc::opts::input_data input_opts;
     traccc::opts::clusterization clusterization_opts;
     traccc::opts::track_seeding seeding_opts;
@@ -551,13 +555,14 @@ int main(int argc, char* argv[]) {
     traccc::opts::accelerator accelerator_opts;
     traccc::opts::program_options program_opts{
         "Full Tracking Chain Using CUDA",
-        {detector_opts, input_opts, clusterization_opts, seeding_opts,
-         finding_opts, propagation_opts, performance_opts, accelerator_opts},
+        {detector_opts, cache_opts, input_opts, clusterization_opts,
+         seeding_opts, finding_opts, propagation_opts, performance_opts,
+         accelerator_opts},
         argc,
         argv};
 
     // Run the application.
-    return seq_run(detector_opts, input_opts, clusterization_opts, seeding_opts,
-                   finding_opts, propagation_opts, performance_opts,
-                   accelerator_opts);
+    return seq_run(detector_opts, cache_opts, input_opts, clusterization_opts,
+                   seeding_opts, finding_opts, propagation_opts,
+                   performance_opts, accelerator_opts);
 }
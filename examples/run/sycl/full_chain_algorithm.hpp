@@ -12,6 +12,7 @@
 #include "traccc/finding/finding_algorithm.hpp"
 #include "traccc/fitting/fitting_algorithm.hpp"
 #include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/performance/timing_info.hpp"
 #include "traccc/sycl/clusterization/clusterization_algorithm.hpp"
 #include "traccc/sycl/clusterization/spacepoint_formation_algorithm.hpp"
 #include "traccc/sycl/seeding/seeding_algorithm.hpp"
@@ -80,6 +81,9 @@ class full_chain_algorithm
     ///           objects
     /// @param target_cells_per_partition The average number of cells in each
     /// partition.
+    /// @param timing Timing information to record the latencies of the
+    ///               individual reconstruction stages into (optional). The
+    ///               queue is waited on after every stage when it is set.
     ///
     full_chain_algorithm(
         vecmem::memory_resource& host_mr,
@@ -89,7 +93,8 @@ class full_chain_algorithm
         const seedfilter_config& filter_config,
         const finding_algorithm::config_type& finding_config = {},
         const fitting_algorithm::config_type& fitting_config = {},
-        detector_type* detector = nullptr);
+        detector_type* detector = nullptr,
+        performance::timing_info* timing = nullptr);
 
     /// Copy constructor
     ///
@@ -125,6 +130,9 @@ class full_chain_algorithm
     /// Memory copy object
     mutable vecmem::sycl::async_copy m_copy;
 
+    /// Timing information for the reconstruction stages
+    performance::timing_info* m_timing;
+
     /// @name Sub-algorithms used by this full-chain algorithm
     /// @{
 
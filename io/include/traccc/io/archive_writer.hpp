@@ -0,0 +1,101 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace traccc::io {
+
+/// Writer of an event archive (@c traccc::data_format::archive)
+///
+/// The writer (re-)creates the archive file of a directory, replacing any
+/// archive that was written into it before. The per-event sections are
+/// appended to the file as they are written, while the event table is only
+/// kept in memory. The table and the header of the archive are written when
+/// the writer is closed.
+///
+/// Sections that an event already has in the archive with the same content
+/// are not written again. (This is the case for the modules, which are
+/// written together with every kind of collection.)
+///
+/// The writer must not be used concurrently.
+///
+class archive_writer {
+
+    public:
+    /// Create a new archive
+    ///
+    /// @param directory The directory to create the archive in
+    /// @throw std::runtime_error If the archive could not be created
+    ///
+    explicit archive_writer(std::string_view directory);
+    /// Destructor, closing the archive if that was not done yet
+    ///
+    /// Errors of closing the archive can only be caught by calling
+    /// @c close() explicitly.
+    ///
+    ~archive_writer();
+
+    /// No copy constructor
+    archive_writer(const archive_writer&) = delete;
+    /// No copy assignment
+    archive_writer& operator=(const archive_writer&) = delete;
+
+    /// Write the cells of an event
+    ///
+    /// @param event is the event index
+    /// @param cells is the cell collection to write
+    /// @param modules is the module collection to write
+    ///
+    void write(std::size_t event,
+               traccc::cell_collection_types::const_view cells,
+               traccc::cell_module_collection_types::const_view modules);
+
+    /// Write the spacepoints (hits) of an event
+    ///
+    /// @param event is the event index
+    /// @param spacepoints is the spacepoint collection to write
+    /// @param modules is the module collection to write
+    ///
+    void write(std::size_t event,
+               spacepoint_collection_types::const_view spacepoints,
+               traccc::cell_module_collection_types::const_view modules);
+
+    /// Write the measurements of an event
+    ///
+    /// @param event is the event index
+    /// @param measurements is the measurement collection to write
+    /// @param modules is the module collection to write
+    ///
+    void write(std::size_t event,
+               measurement_collection_types::const_view measurements,
+               traccc::cell_module_collection_types::const_view modules);
+
+    /// Write the event table and the header, and close the archive
+    ///
+    /// @throw std::runtime_error If the archive could not be written
+    ///
+    void close();
+
+    private:
+    /// Internal state of the writer
+    struct impl;
+    /// The internal state of the writer (null once closed)
+    std::unique_ptr<impl> m_impl;
+
+};  // class archive_writer
+
+}  // namespace traccc::io
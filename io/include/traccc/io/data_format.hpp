@@ -18,6 +18,7 @@ enum data_format : int {
     binary = 1,  ///< Binary format
     json = 2,    ///< JSON format
     obj = 3,     ///< Wavefront OBJ format
+    archive = 4, ///< Binary format, with all events in a single file
 };
 
 /// Printout helper for @c traccc::data_format
@@ -0,0 +1,139 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/data_format.hpp"
+#include "traccc/io/digitization_config.hpp"
+
+// Project include(s).
+#include "traccc/geometry/geometry.hpp"
+
+// Detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/// @file
+///
+/// Binary cache of the detector description used by the event data readers
+///
+/// The cache saves the parsing of the geometry (@c traccc::io::read_geometry)
+/// and of the digitization configuration
+/// (@c traccc::io::read_digitization_config) files at startup. It does not
+/// hold the Detray detector. Applications that use one still read it with
+/// @c detray::io::read_detector, from its JSON files, on every start.
+///
+
+namespace traccc::io {
+
+/// Description of the detector, as needed for reading event data
+struct detector_description {
+
+    /// The placements of the detector modules
+    geometry surface_transforms;
+    /// Mapping from Acts geometry identifiers to Detray barcodes (if any)
+    std::unique_ptr<std::map<std::uint64_t, detray::geometry::barcode>>
+        barcode_map;
+    /// The digitization configuration of the detector
+    digitization_config digi_cfg;
+
+};  // struct detector_description
+
+/// The source files that a detector description is read from
+struct detector_cache_sources {
+
+    /// The file describing the detector geometry
+    std::string detector_file;
+    /// The file describing the detector digitization
+    std::string digitization_file;
+    /// The format of the geometry file
+    data_format geometry_format = data_format::csv;
+
+};  // struct detector_cache_sources
+
+/// Current version of the detector cache file format
+///
+/// Caches written with a different version are rejected when reading them.
+///
+inline constexpr std::uint32_t detector_cache_version = 2u;
+
+/// Write a detector description into a binary cache file
+///
+/// The file is written into a temporary file first, which is then renamed
+/// to @c filename. So that concurrent jobs would never see a partially
+/// written cache.
+///
+/// The absolute paths, sizes and modification times of the source files, and
+/// the format of the geometry file, are recorded in the cache. So that
+/// @c traccc::io::detector_cache_is_valid could recognise outdated caches.
+///
+/// @param filename The name of the cache file to write (used as-is)
+/// @param desc The detector description to write
+/// @param sources The files that @c desc was read from
+/// @throw std::runtime_error If the file could not be written
+/// @throw std::invalid_argument If the digitization configuration can not be
+///                              represented in the cache
+///
+void write_detector_cache(std::string_view filename,
+                          const detector_description& desc,
+                          const detector_cache_sources& sources);
+
+/// Check whether a detector cache can be used in place of its source files
+///
+/// @param filename The name of the cache file to check (used as-is)
+/// @param sources The files that the detector description should come from
+/// @return @c true if @c filename is a readable detector cache, written from
+///         the same source files (with the same sizes and modification
+///         times) and with the same geometry format as @c sources
+///
+bool detector_cache_is_valid(std::string_view filename,
+                             const detector_cache_sources& sources);
+
+/// Read a detector description from a binary cache file
+///
+/// The file is memory mapped, and its contents are copied into the result
+/// without any parsing. The source files recorded in the cache are not
+/// checked by this function.
+///
+/// @param filename The name of the cache file to read (used as-is)
+/// @return The detector description held by the cache
+/// @throw std::runtime_error If the file is not a valid detector cache, was
+///                           written with a different format version, or on
+///                           a platform with a different data layout
+///
+detector_description read_detector_cache(std::string_view filename);
+
+/// Read the detector description, using a binary cache if possible
+///
+/// If @c cache_file is not empty, and holds a valid cache of the geometry and
+/// digitization files, the description is read from it. Otherwise it is read
+/// from the geometry and digitization files, and (re-)written into
+/// @c cache_file (if one was given) for the next jobs to use.
+///
+/// Note that the cache only holds the description of the detector modules
+/// used by the event data readers. It does not hold the Detray detector, so
+/// it does not save the time of @c detray::io::read_detector.
+///
+/// @param detector_file The file describing the detector geometry
+/// @param digitization_file The file describing the detector digitization
+/// @param geometry_format The format of the geometry file
+/// @param cache_file The binary cache file to use (optional)
+/// @return The detector description
+///
+detector_description read_detector_description(
+    std::string_view detector_file, std::string_view digitization_file,
+    data_format geometry_format = data_format::csv,
+    std::string_view cache_file = "");
+
+}  // namespace traccc::io
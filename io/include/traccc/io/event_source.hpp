@@ -0,0 +1,190 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/data_format.hpp"
+#include "traccc/io/digitization_config.hpp"
+#include "traccc/io/mapped_binary.hpp"
+#include "traccc/io/reader_edm.hpp"
+
+// Project include(s).
+#include "traccc/geometry/geometry.hpp"
+
+// Detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace traccc::io {
+
+/// Asynchronous source of (cell) input events
+///
+/// The events are read by a dedicated pool of reader threads, into a
+/// bounded queue. At most @c traccc::io::event_source::config::prefetch
+/// events are held by the source at any time (being read, or waiting to be
+/// picked up), so the memory used for the input does not depend on the
+/// number of events that are processed.
+///
+/// The input event files are replayed cyclically until the requested number
+/// of events has been produced. With more than one reader thread the events
+/// may be delivered out of order.
+///
+class event_source {
+
+    public:
+    /// Configuration for the event source
+    struct config {
+        /// The directory holding the event files
+        std::string directory;
+        /// The file describing the detector geometry
+        std::string detector_file;
+        /// The file describing the detector digitization
+        std::string digitization_file;
+        /// The format of the event file(s)
+        data_format event_format = data_format::csv;
+        /// The format of the geometry file
+        data_format geometry_format = data_format::csv;
+        /// Binary detector description cache (optional, written if missing)
+        std::string detector_cache_file;
+        /// The number of event files available in the input directory
+        std::size_t input_events = 1;
+        /// The total number of events to produce
+        std::size_t events = 1;
+        /// The maximum number of events held by the source at any time
+        std::size_t prefetch = 8;
+        /// The number of reader threads to use
+        std::size_t reader_threads = 1;
+        /// Start reading events right away, or only on @c start()
+        bool start_reading = true;
+    };
+
+    /// Type of the events produced by the source
+    using event_type = cell_reader_output;
+
+    /// Construct the source, and start reading events in the background
+    ///
+    /// The detector description needed for reading the events is set up
+    /// here in any case. Reading the events themselves is only started
+    /// later if @c traccc::io::event_source::config::start_reading is false.
+    ///
+    /// @param cfg The configuration of the source
+    /// @param mr The (thread safe) memory resource to read the events with
+    ///
+    event_source(const config& cfg, vecmem::memory_resource& mr);
+    /// Destructor, stopping and joining the reader threads
+    ~event_source();
+
+    /// No copy constructor
+    event_source(const event_source&) = delete;
+    /// No copy assignment
+    event_source& operator=(const event_source&) = delete;
+
+    /// Start reading events in the background, if that did not happen yet
+    void start();
+
+    /// Get the next event from the source
+    ///
+    /// Starts reading events if needed, and blocks until an event is
+    /// available.
+    ///
+    /// @return The next event, or a null pointer once all events were
+    ///         delivered
+    /// @throw Any exception thrown while reading the event files
+    ///
+    std::unique_ptr<event_type> next();
+
+    /// Block until the prefetch queue is full, or all events were read
+    ///
+    /// Starts reading events if needed.
+    ///
+    /// @throw Any exception thrown while reading the event files
+    ///
+    void wait_for_prefetch();
+
+    /// Get the total time spent in @c next() waiting for events to be read
+    std::chrono::nanoseconds wait_time() const;
+
+    private:
+    /// Start the reader threads, if they are not running yet
+    ///
+    /// Must be called with @c m_mutex locked.
+    ///
+    void start_readers();
+    /// Function executed by the reader threads
+    void read_events();
+    /// Read a single event file
+    void read_event(event_type& out, std::size_t event) const;
+
+    /// The configuration of the source
+    config m_cfg;
+    /// The memory resource to read the events with
+    vecmem::memory_resource& m_mr;
+
+    /// @name Objects needed for reading the event files
+    /// @{
+
+    /// The detector geometry (for the non-archive formats)
+    geometry m_geometry;
+    /// The digitization configuration (for the non-archive formats)
+    digitization_config m_digi_cfg;
+    /// The barcode re-mapping (for the non-archive formats)
+    std::unique_ptr<std::map<std::uint64_t, detray::geometry::barcode>>
+        m_barcode_map;
+    /// The mapped event archive (for the archive format)
+    std::unique_ptr<mapped_file> m_archive;
+
+    /// @}
+
+    /// @name State shared between the reader threads and the consumer(s)
+    /// @{
+
+    /// Mutex protecting the shared state
+    mutable std::mutex m_mutex;
+    /// Condition signalled when an event is added to the queue
+    std::condition_variable m_event_ready;
+    /// Condition signalled when room is made in the queue
+    std::condition_variable m_slot_free;
+    /// The events read, and not yet picked up
+    std::deque<std::unique_ptr<event_type>> m_queue;
+    /// The number of events currently being read
+    std::size_t m_reading = 0u;
+    /// The number of events handed to the reader threads
+    std::size_t m_scheduled = 0u;
+    /// The number of events handed to the consumer(s)
+    std::size_t m_delivered = 0u;
+    /// Flag telling the reader threads to stop
+    bool m_stop = false;
+    /// The first exception thrown by a reader thread
+    std::exception_ptr m_error;
+    /// Time spent waiting in @c next()
+    std::chrono::nanoseconds m_wait_time{0};
+
+    /// @}
+
+    /// The reader threads
+    std::vector<std::thread> m_readers;
+
+};  // class event_source
+
+}  // namespace traccc::io
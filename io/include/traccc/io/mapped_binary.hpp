@@ -0,0 +1,200 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace traccc::io {
+
+/// Read-only memory mapping of a complete file
+///
+/// The mapping is released when the object is destroyed.
+///
+class mapped_file {
+
+    public:
+    /// Map a file into memory
+    ///
+    /// @param filename The full name of the file to map
+    /// @throw std::runtime_error If the file could not be opened or mapped
+    ///
+    explicit mapped_file(std::string_view filename);
+    /// Move constructor
+    mapped_file(mapped_file&& parent) noexcept;
+    /// Destructor, unmapping the file
+    ~mapped_file();
+
+    /// Move assignment
+    mapped_file& operator=(mapped_file&& rhs) noexcept;
+
+    /// No copy constructor
+    mapped_file(const mapped_file&) = delete;
+    /// No copy assignment
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /// Get the (page aligned) beginning of the mapped file
+    const unsigned char* data() const { return m_data; }
+    /// Get the size of the mapped file
+    std::size_t size() const { return m_size; }
+
+    private:
+    /// Beginning of the mapped memory
+    const unsigned char* m_data = nullptr;
+    /// Size of the mapped file
+    std::size_t m_size = 0u;
+
+};  // class mapped_file
+
+/// Zero-copy access to a collection written in the binary data format
+///
+/// The collection is accessed directly from the memory mapped file, without
+/// any allocation or copy. The size of the collection is validated against
+/// the length of the file.
+///
+/// @tparam T The type of the collection's elements
+///
+template <typename T>
+class mapped_collection {
+
+    // Make sure that the chosen type works.
+    static_assert(std::is_standard_layout_v<T>,
+                  "Collection item type must be standard layout.");
+
+    public:
+    /// The collection's element type
+    using value_type = T;
+    /// Non-owning view of the collection
+    using const_view = typename collection_types<T>::const_view;
+
+    /// Map a binary collection file into memory
+    ///
+    /// @param filename The full name of the file to map
+    /// @throw std::runtime_error If the file could not be mapped, or if its
+    ///                           content is not a valid collection
+    ///
+    explicit mapped_collection(std::string_view filename) : m_file(filename) {
+
+        // The file starts with the size of the collection.
+        std::size_t size = 0u;
+        if (m_file.size() < sizeof(std::size_t)) {
+            throw std::runtime_error("File " + std::string(filename) +
+                                     " is too small to hold a collection");
+        }
+        std::memcpy(&size, m_file.data(), sizeof(std::size_t));
+
+        // Which must be followed by exactly the payload of the collection.
+        const std::size_t payload_size = m_file.size() - sizeof(std::size_t);
+        if ((size > payload_size / sizeof(T)) ||
+            (size * sizeof(T) != payload_size)) {
+            throw std::runtime_error(
+                "File " + std::string(filename) + " of " +
+                std::to_string(m_file.size()) + " bytes can not hold " +
+                std::to_string(size) + " elements of " +
+                std::to_string(sizeof(T)) + " bytes");
+        }
+        if (size > std::numeric_limits<
+                       typename const_view::size_type>::max()) {
+            throw std::runtime_error("Collection in file " +
+                                     std::string(filename) + " is too large");
+        }
+
+        // The payload has to be correctly aligned to be used in place.
+        const unsigned char* payload = m_file.data() + sizeof(std::size_t);
+        if (reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0u) {
+            throw std::runtime_error("Collection in file " +
+                                     std::string(filename) +
+                                     " is not correctly aligned");
+        }
+
+        m_size = size;
+        m_data = reinterpret_cast<const T*>(payload);
+    }
+
+    /// Get the number of elements in the collection
+    std::size_t size() const { return m_size; }
+    /// Get the elements of the collection
+    const T* data() const { return m_data; }
+
+    /// Get a view of the collection
+    const_view view() const {
+        return {static_cast<typename const_view::size_type>(m_size), m_data};
+    }
+
+    private:
+    /// The mapped file
+    mapped_file m_file;
+    /// Number of elements in the collection
+    std::size_t m_size = 0u;
+    /// The elements of the collection, inside of the mapped file
+    const T* m_data = nullptr;
+
+};  // class mapped_collection
+
+/// Memory mapped cells and modules of an event
+struct mapped_cell_reader_output {
+    mapped_collection<cell> cells;
+    mapped_collection<cell_module> modules;
+};
+
+/// Memory mapped measurements and modules of an event
+struct mapped_measurement_reader_output {
+    mapped_collection<measurement> measurements;
+    mapped_collection<cell_module> modules;
+};
+
+/// Memory mapped spacepoints and modules of an event
+struct mapped_spacepoint_reader_output {
+    mapped_collection<spacepoint> spacepoints;
+    mapped_collection<cell_module> modules;
+};
+
+/// Map the binary cell data of an event into memory
+///
+/// The files to map are selected according the naming conventions used in
+/// our data.
+///
+/// @param event The event ID to map the cells for
+/// @param directory The directory holding the cell data files
+/// @return The memory mapped cells and modules
+///
+mapped_cell_reader_output map_cells(std::size_t event,
+                                    std::string_view directory);
+
+/// Map the binary measurement data of an event into memory
+///
+/// @param event The event ID to map the measurements for
+/// @param directory The directory holding the measurement data files
+/// @return The memory mapped measurements and modules
+///
+mapped_measurement_reader_output map_measurements(std::size_t event,
+                                                  std::string_view directory);
+
+/// Map the binary spacepoint (hit) data of an event into memory
+///
+/// @param event The event ID to map the spacepoints for
+/// @param directory The directory holding the spacepoint data files
+/// @return The memory mapped spacepoints and modules
+///
+mapped_spacepoint_reader_output map_spacepoints(std::size_t event,
+                                                std::string_view directory);
+
+}  // namespace traccc::io
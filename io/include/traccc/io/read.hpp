@@ -28,11 +28,14 @@ namespace traccc::io {
 /// @param digi_config_file The file describing the detector digitization
 /// @param event_format The format of the event file(s)
 /// @param geometry_format The format of the geometry file
+/// @param detector_cache_file Binary detector description cache to use
+///                            (optional, written if it does not exist yet)
 ///
 void read(demonstrator_input& out, std::size_t events,
           std::string_view directory, std::string_view detector_file,
           std::string_view digi_config_file,
           data_format event_format = data_format::csv,
-          data_format geometry_format = data_format::csv);
+          data_format geometry_format = data_format::csv,
+          std::string_view detector_cache_file = "");
 
 }  // namespace traccc::io
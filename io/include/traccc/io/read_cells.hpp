@@ -9,6 +9,7 @@
 
 // Local include(s).
 #include "traccc/io/data_format.hpp"
+#include "traccc/io/mapped_binary.hpp"
 #include "traccc/io/reader_edm.hpp"
 
 // Project include(s).
@@ -68,4 +69,17 @@ void read_cells(cell_reader_output &out, std::string_view filename,
                     *barcode_map = nullptr,
                 bool deduplicate = true);
 
+/// Read cell data into memory from an event archive
+///
+/// Allows reading many events from an archive that is only mapped into
+/// memory once.
+///
+/// @param out A cell & a cell_module (host) collections
+/// @param event The event ID to read in the cells for
+/// @param archive The memory mapped event archive
+///                (in the @c traccc::data_format::archive format)
+///
+void read_cells(cell_reader_output &out, std::size_t event,
+                const mapped_file &archive);
+
 }  // namespace traccc::io
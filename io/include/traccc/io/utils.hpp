@@ -28,6 +28,13 @@ const std::string& data_directory();
 ///
 std::string get_event_filename(std::size_t event, std::string_view suffix);
 
+/// Get the name of the event archive file
+///
+/// @return The standardized name of the file holding all events of a sample
+///         in the @c traccc::data_format::archive format
+///
+std::string get_archive_filename();
+
 /// Get the absolute path to a file or directory
 ///
 /// This function would just return the received path as-is if it is already
@@ -0,0 +1,188 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/cell.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/io/mapped_binary.hpp"
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/// @file
+///
+/// Layout of the event archive (@c traccc::data_format::archive) files
+///
+/// An event archive holds the binary data of many events in a single file:
+///  - An @c archive_header, at the beginning of the file;
+///  - The payloads of the per-event sections (cells, modules, measurements
+///    and spacepoints), each starting at a multiple of
+///    @c archive_alignment bytes;
+///  - The event table, one @c archive_event per event ID, at the offset
+///    given in the header.
+/// So the data of any event can be found with two lookups.
+///
+
+namespace traccc::io::details {
+
+/// Alignment of all sections of an event archive
+inline constexpr std::uint64_t archive_alignment = 64u;
+
+/// Identifier at the beginning of every event archive
+inline constexpr std::array<char, 8> archive_magic = {'T', 'R', 'C', 'C',
+                                                      'A', 'R', 'C', 'H'};
+
+/// Version of the event archive layout
+inline constexpr std::uint32_t archive_version = 1u;
+
+/// The kinds of per-event sections in an event archive
+enum archive_section_kind : std::size_t {
+    cells = 0,
+    modules = 1,
+    measurements = 2,
+    spacepoints = 3,
+    n_section_kinds = 4
+};
+
+/// Header at the beginning of an event archive
+struct archive_header {
+    /// Identifier of the file type
+    std::array<char, 8> magic = archive_magic;
+    /// Version of the archive layout
+    std::uint32_t version = archive_version;
+    /// Alignment of the sections of the archive
+    std::uint32_t alignment = archive_alignment;
+    /// Number of entries in the event table
+    std::uint64_t n_events = 0u;
+    /// Offset of the event table in the file
+    std::uint64_t table_offset = archive_alignment;
+    /// Sizes of the elements of the different kinds of sections
+    std::array<std::uint64_t, n_section_kinds> element_sizes = {
+        sizeof(cell), sizeof(cell_module), sizeof(measurement),
+        sizeof(spacepoint)};
+};
+static_assert(sizeof(archive_header) == archive_alignment,
+              "Unexpected event archive header size");
+
+/// Location of one section in an event archive
+struct archive_section {
+    /// Offset of the section in the file (0 for sections not written)
+    std::uint64_t offset = 0u;
+    /// Number of elements in the section
+    std::uint64_t size = 0u;
+};
+
+/// Entry of the event table of an event archive
+struct archive_event {
+    /// The sections of the event
+    std::array<archive_section, n_section_kinds> sections;
+};
+static_assert(sizeof(archive_event) == archive_alignment,
+              "Unexpected event archive table entry size");
+
+/// Round up an offset to the alignment of the archive sections
+inline std::uint64_t archive_align(std::uint64_t offset) {
+    return (offset + archive_alignment - 1u) / archive_alignment *
+           archive_alignment;
+}
+
+/// Check that an archive header is compatible with this version of the code
+///
+/// @param header The header to check
+///
+inline void check_archive_header(const archive_header& header) {
+
+    const archive_header expected;
+    if ((header.magic != expected.magic) ||
+        (header.version != expected.version) ||
+        (header.alignment != expected.alignment)) {
+        throw std::runtime_error("File is not a (supported) event archive");
+    }
+    if (header.element_sizes != expected.element_sizes) {
+        throw std::runtime_error(
+            "Event archive was written with a different event data model");
+    }
+}
+
+/// Look up an event in a memory mapped event archive
+///
+/// @param archive The memory mapped archive
+/// @param event The event ID to look up
+/// @return The table entry of the event
+///
+inline archive_event read_archive_event(const mapped_file& archive,
+                                        std::size_t event) {
+
+    archive_header header;
+    if (archive.size() < sizeof(archive_header)) {
+        throw std::runtime_error("Event archive is too small");
+    }
+    std::memcpy(&header, archive.data(), sizeof(archive_header));
+    check_archive_header(header);
+    if ((header.table_offset > archive.size()) ||
+        (header.n_events >
+         (archive.size() - header.table_offset) / sizeof(archive_event))) {
+        throw std::runtime_error("Event archive has a truncated event table");
+    }
+    if (event >= header.n_events) {
+        throw std::runtime_error("Event " + std::to_string(event) +
+                                 " is not in the event archive");
+    }
+
+    archive_event result;
+    std::memcpy(&result,
+                archive.data() + header.table_offset +
+                    event * sizeof(archive_event),
+                sizeof(archive_event));
+    return result;
+}
+
+/// Read one section of an event from a memory mapped event archive
+///
+/// @param archive The memory mapped archive
+/// @param entry The table entry of the event
+/// @param kind The kind of section to read
+/// @param result The collection to fill
+///
+template <typename collection_t>
+void read_archive_section(const mapped_file& archive,
+                          const archive_event& entry, archive_section_kind kind,
+                          collection_t& result) {
+
+    // Make sure that the chosen types work.
+    static_assert(std::is_standard_layout_v<typename collection_t::value_type>,
+                  "Collection item type must be standard layout.");
+    constexpr std::size_t item_size =
+        sizeof(typename collection_t::value_type);
+
+    // Check that the section is valid.
+    const archive_section& section = entry.sections[kind];
+    if (section.offset == 0u) {
+        throw std::runtime_error(
+            "Requested data was not written into the event archive");
+    }
+    if ((section.offset > archive.size()) ||
+        (section.size > (archive.size() - section.offset) / item_size)) {
+        throw std::runtime_error("Event archive has a truncated section");
+    }
+
+    // Copy the section into the result collection.
+    result.resize(section.size);
+    std::memcpy(result.data(), archive.data() + section.offset,
+                section.size * item_size);
+}
+
+}  // namespace traccc::io::details
@@ -0,0 +1,236 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/archive_writer.hpp"
+
+#include "archive.hpp"
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace traccc::io {
+
+namespace {
+
+/// Data of one section to write into an event archive
+struct archive_payload {
+    /// The kind of section
+    details::archive_section_kind kind;
+    /// The elements of the section
+    const char* data;
+    /// Number of elements in the section
+    std::size_t size;
+    /// Size of one element of the section
+    std::size_t item_size;
+};
+
+/// Create the payload of an archive section from a collection
+///
+/// @param kind The kind of section to create
+/// @param collection The collection to write into the section
+///
+template <typename collection_t>
+archive_payload make_archive_payload(details::archive_section_kind kind,
+                                     const collection_t& collection) {
+
+    // Make sure that the chosen types work.
+    static_assert(std::is_standard_layout_v<typename collection_t::value_type>,
+                  "Collection item type must have standard layout.");
+
+    return {kind, reinterpret_cast<const char*>(collection.data()),
+            collection.size(), sizeof(typename collection_t::value_type)};
+}
+
+}  // namespace
+
+struct archive_writer::impl {
+
+    /// Write the sections of one event into the archive
+    ///
+    /// @param event is the event index
+    /// @param payloads are the sections to write
+    ///
+    void write(std::size_t event,
+               std::initializer_list<archive_payload> payloads) {
+
+        if (table.size() <= event) {
+            table.resize(event + 1);
+        }
+        details::archive_event& entry = table[event];
+
+        for (const archive_payload& payload : payloads) {
+
+            const std::size_t n_bytes = payload.size * payload.item_size;
+            details::archive_section& section = entry.sections[payload.kind];
+
+            // Check if the section is already in the archive.
+            if ((section.offset != 0u) && (section.size == payload.size)) {
+                buffer.resize(n_bytes);
+                file.seekg(static_cast<std::streamoff>(section.offset));
+                file.read(buffer.data(),
+                          static_cast<std::streamsize>(n_bytes));
+                if (file &&
+                    std::equal(buffer.begin(), buffer.end(), payload.data)) {
+                    continue;
+                }
+                file.clear();
+            }
+
+            // Append the section, padded to the alignment of the archive.
+            section = {offset, payload.size};
+            const std::uint64_t end = details::archive_align(offset + n_bytes);
+            buffer.assign(end - offset - n_bytes, 0);
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.write(payload.data, static_cast<std::streamsize>(n_bytes));
+            file.write(buffer.data(),
+                       static_cast<std::streamsize>(buffer.size()));
+            offset = end;
+        }
+        if (!file) {
+            throw std::runtime_error("Failed to write into " + filename);
+        }
+    }
+
+    /// Write the event table and the header of the archive
+    void finish() {
+
+        details::archive_header header;
+        header.n_events = table.size();
+        header.table_offset = offset;
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char*>(table.data()),
+                   static_cast<std::streamsize>(
+                       table.size() * sizeof(details::archive_event)));
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header),
+                   sizeof(details::archive_header));
+        file.close();
+        if (!file) {
+            throw std::runtime_error("Failed to write into " + filename);
+        }
+    }
+
+    /// The name of the archive file
+    std::string filename;
+    /// The archive file
+    std::fstream file;
+    /// The event table of the archive
+    std::vector<details::archive_event> table;
+    /// The offset of the end of the last section in the file
+    std::uint64_t offset = sizeof(details::archive_header);
+    /// Scratch buffer used for comparing and padding sections
+    std::vector<char> buffer;
+
+};  // struct archive_writer::impl
+
+archive_writer::archive_writer(std::string_view directory)
+    : m_impl(std::make_unique<impl>()) {
+
+    m_impl->filename = get_absolute_path(
+        (std::filesystem::path(directory) /
+         std::filesystem::path(get_archive_filename()))
+            .native());
+
+    // Replace any previous archive. Its header is only valid once the
+    // archive is closed.
+    m_impl->file.open(m_impl->filename, std::ios::binary | std::ios::in |
+                                            std::ios::out | std::ios::trunc);
+    if (!m_impl->file.is_open()) {
+        throw std::runtime_error("Failed to create file: " +
+                                 m_impl->filename);
+    }
+    const std::vector<char> placeholder(sizeof(details::archive_header), 0);
+    m_impl->file.write(placeholder.data(),
+                       static_cast<std::streamsize>(placeholder.size()));
+    if (!m_impl->file) {
+        throw std::runtime_error("Failed to write into " + m_impl->filename);
+    }
+}
+
+archive_writer::~archive_writer() {
+
+    try {
+        close();
+    } catch (...) {
+    }
+}
+
+void archive_writer::write(
+    std::size_t event, traccc::cell_collection_types::const_view cells,
+    traccc::cell_module_collection_types::const_view modules) {
+
+    if (!m_impl) {
+        throw std::runtime_error("The event archive is already closed");
+    }
+    m_impl->write(
+        event,
+        {make_archive_payload(
+             details::archive_section_kind::cells,
+             traccc::cell_collection_types::const_device{cells}),
+         make_archive_payload(
+             details::archive_section_kind::modules,
+             traccc::cell_module_collection_types::const_device{modules})});
+}
+
+void archive_writer::write(
+    std::size_t event, spacepoint_collection_types::const_view spacepoints,
+    traccc::cell_module_collection_types::const_view modules) {
+
+    if (!m_impl) {
+        throw std::runtime_error("The event archive is already closed");
+    }
+    m_impl->write(
+        event,
+        {make_archive_payload(
+             details::archive_section_kind::spacepoints,
+             traccc::spacepoint_collection_types::const_device{spacepoints}),
+         make_archive_payload(
+             details::archive_section_kind::modules,
+             traccc::cell_module_collection_types::const_device{modules})});
+}
+
+void archive_writer::write(
+    std::size_t event, measurement_collection_types::const_view measurements,
+    traccc::cell_module_collection_types::const_view modules) {
+
+    if (!m_impl) {
+        throw std::runtime_error("The event archive is already closed");
+    }
+    m_impl->write(
+        event,
+        {make_archive_payload(
+             details::archive_section_kind::measurements,
+             traccc::measurement_collection_types::const_device{
+                 measurements}),
+         make_archive_payload(
+             details::archive_section_kind::modules,
+             traccc::cell_module_collection_types::const_device{modules})});
+}
+
+void archive_writer::close() {
+
+    if (!m_impl) {
+        return;
+    }
+    // Release the state even if writing the table fails.
+    const std::unique_ptr<impl> state = std::move(m_impl);
+    state->finish();
+}
+
+}  // namespace traccc::io
@@ -8,34 +8,22 @@
 // Local include(s).
 #include "read_cells.hpp"
 
-#include "traccc/io/csv/make_cell_reader.hpp"
+#include "traccc/io/mapped_binary.hpp"
 
 // System include(s).
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <charconv>
 #include <iostream>
-#include <map>
-#include <set>
 #include <stdexcept>
+#include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
 namespace {
 
-/// Comparator used for sorting cells. This sorting is one of the assumptions
-/// made in the clusterization algorithm
-struct cell_order {
-    bool operator()(const traccc::cell& lhs, const traccc::cell& rhs) const {
-        if (lhs.module_link != rhs.module_link) {
-            return lhs.module_link < rhs.module_link;
-        } else if (lhs.channel1 != rhs.channel1) {
-            return (lhs.channel1 < rhs.channel1);
-        } else {
-            return (lhs.channel0 < rhs.channel0);
-        }
-    }
-};  // struct cell_order
-
 /// Helper function which finds module from csv::cell in the geometry and
 /// digitization config, and initializes the modules limits with the cell's
 /// properties
@@ -89,79 +77,242 @@ traccc::cell_module get_module(const std::uint64_t geometry_id,
     return result;
 }
 
-std::map<std::uint64_t, std::vector<traccc::cell> > read_deduplicated_cells(
-    std::string_view filename) {
-
-    // Temporary storage for all the cells and modules.
-    std::map<std::uint64_t, std::map<traccc::cell, float, ::cell_order> >
-        cellMap;
+/// Cell information, as read from a CSV file
+struct csv_cell {
+    std::uint64_t geometry_id = 0;
+    std::uint32_t channel0 = 0;
+    std::uint32_t channel1 = 0;
+    float timestamp = 0.f;
+    float value = 0.f;
+};  // struct csv_cell
+
+/// The columns of a cell CSV file
+enum class cell_column {
+    geometry_id,
+    hit_id,
+    channel0,
+    channel1,
+    timestamp,
+    value,
+    unknown
+};
+
+/// Identify a column of a cell CSV file by its name
+cell_column get_cell_column(std::string_view name) {
+
+    if (name == "geometry_id") {
+        return cell_column::geometry_id;
+    } else if (name == "hit_id") {
+        return cell_column::hit_id;
+    } else if (name == "channel0") {
+        return cell_column::channel0;
+    } else if (name == "channel1") {
+        return cell_column::channel1;
+    } else if (name == "timestamp") {
+        return cell_column::timestamp;
+    } else if (name == "value") {
+        return cell_column::value;
+    }
+    return cell_column::unknown;
+}
 
-    // Construct the cell reader object.
-    auto reader = traccc::io::csv::make_cell_reader(filename);
+/// Parse one field of a CSV file
+template <typename T>
+void parse_field(const char* first, const char* last, T& value,
+                 std::string_view filename, std::size_t line) {
+
+    const auto [ptr, ec] = std::from_chars(first, last, value);
+    if ((ec != std::errc{}) || (ptr != last)) {
+        throw std::runtime_error("Could not parse \"" +
+                                 std::string(first, last) + "\" on line " +
+                                 std::to_string(line) + " of " +
+                                 std::string(filename));
+    }
+}
 
-    // Read all cells from input file.
-    traccc::io::csv::cell iocell;
-    unsigned int nduplicates = 0;
-    while (reader.read(iocell)) {
+/// Get the lines of a memory mapped file one by one, without the line endings
+class line_reader {
 
-        // Construct a cell object.
-        const traccc::cell cell{iocell.channel0, iocell.channel1, iocell.value,
-                                iocell.timestamp, 0};
+    public:
+    explicit line_reader(const traccc::io::mapped_file& file)
+        : m_current(reinterpret_cast<const char*>(file.data())),
+          m_end(m_current + file.size()) {}
 
-        // Add the cell to the module. At this point the module link of the
-        // cells is not set up correctly yet.
-        auto ret = cellMap[iocell.geometry_id].insert({cell, iocell.value});
-        if (ret.second == false) {
-            cellMap[iocell.geometry_id].at(cell) += iocell.value;
-            ++nduplicates;
+    /// Get the next line, returning @c false at the end of the file
+    bool next(std::string_view& line) {
+        if (m_current == m_end) {
+            return false;
         }
+        const char* eol = std::find(m_current, m_end, '\n');
+        const char* last = eol;
+        if ((last != m_current) && (*(last - 1) == '\r')) {
+            --last;
+        }
+        line = std::string_view(m_current,
+                                static_cast<std::size_t>(last - m_current));
+        m_current = (eol == m_end ? m_end : eol + 1);
+        return true;
     }
-    if (nduplicates > 0) {
-        std::cout << "WARNING: @traccc::io::csv::read_cells: " << nduplicates
-                  << " duplicate cells found in " << filename << std::endl;
-    }
 
-    // Create and fill the result container. With summed activation values.
-    std::map<std::uint64_t, std::vector<traccc::cell> > result;
-    for (const auto& [geometry_id, cells] : cellMap) {
-        for (const auto& [cell, value] : cells) {
-            traccc::cell summed_cell{cell};
-            summed_cell.activation = value;
-            result[geometry_id].push_back(summed_cell);
+    private:
+    const char* m_current;
+    const char* m_end;
+};  // class line_reader
+
+/// Read all cells from a CSV file, in the order they appear in the file
+std::vector<csv_cell> read_csv_cells(std::string_view filename) {
+
+    const traccc::io::mapped_file file(filename);
+    line_reader reader(file);
+
+    // Interpret the header.
+    std::string_view line;
+    if (!reader.next(line)) {
+        throw std::runtime_error("Missing header in " + std::string(filename));
+    }
+    std::vector<cell_column> columns;
+    for (std::size_t pos = 0; pos <= line.size();) {
+        const std::size_t comma = std::min(line.find(',', pos), line.size());
+        const std::string_view name = line.substr(pos, comma - pos);
+        columns.push_back(get_cell_column(name));
+        pos = comma + 1;
+    }
+    for (cell_column required :
+         {cell_column::geometry_id, cell_column::channel0,
+          cell_column::channel1, cell_column::value}) {
+        if (std::find(columns.begin(), columns.end(), required) ==
+            columns.end()) {
+            throw std::runtime_error("Missing column(s) in the header of " +
+                                     std::string(filename));
         }
     }
 
-    // Return the container.
+    // Read the cells. Assuming roughly 50 bytes per line for the reservation.
+    std::vector<csv_cell> result;
+    result.reserve(file.size() / 50u);
+    std::size_t line_number = 1;
+    std::uint64_t hit_id = 0;
+    while (reader.next(line)) {
+        ++line_number;
+        if (line.empty()) {
+            continue;
+        }
+        csv_cell& cell = result.emplace_back();
+        const char* current = line.data();
+        const char* const line_end = line.data() + line.size();
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            if (current > line_end) {
+                throw std::runtime_error("Too few columns on line " +
+                                         std::to_string(line_number) + " of " +
+                                         std::string(filename));
+            }
+            const char* const field_end = std::find(current, line_end, ',');
+            switch (columns[i]) {
+                case cell_column::geometry_id:
+                    parse_field(current, field_end, cell.geometry_id, filename,
+                                line_number);
+                    break;
+                case cell_column::hit_id:
+                    parse_field(current, field_end, hit_id, filename,
+                                line_number);
+                    break;
+                case cell_column::channel0:
+                    parse_field(current, field_end, cell.channel0, filename,
+                                line_number);
+                    break;
+                case cell_column::channel1:
+                    parse_field(current, field_end, cell.channel1, filename,
+                                line_number);
+                    break;
+                case cell_column::timestamp:
+                    parse_field(current, field_end, cell.timestamp, filename,
+                                line_number);
+                    break;
+                case cell_column::value:
+                    parse_field(current, field_end, cell.value, filename,
+                                line_number);
+                    break;
+                default:
+                    break;
+            }
+            current = field_end + 1;
+        }
+        if (current <= line_end) {
+            throw std::runtime_error("Too many columns on line " +
+                                     std::to_string(line_number) + " of " +
+                                     std::string(filename));
+        }
+    }
     return result;
 }
 
-std::map<std::uint64_t, std::vector<traccc::cell> > read_all_cells(
-    std::string_view filename) {
-
-    // The result container.
-    std::map<std::uint64_t, std::vector<traccc::cell> > result;
+/// Sort the cells by (geometry_id, channel1, channel0)
+///
+/// Uses a stable LSD radix sort with 8-bit digits. Passes in which all cells
+/// have the same digit are skipped, which is the case for most of the high
+/// bits of the channel identifiers.
+void sort_cells(std::vector<csv_cell>& cells) {
+
+    std::vector<csv_cell> buffer(cells.size());
+    auto sort_by_digit = [&cells, &buffer](auto key, unsigned int shift) {
+        std::array<std::size_t, 256> offsets{};
+        for (const csv_cell& cell : cells) {
+            ++offsets[(key(cell) >> shift) & 0xffu];
+        }
+        if (std::find(offsets.begin(), offsets.end(), cells.size()) !=
+            offsets.end()) {
+            return;
+        }
+        std::size_t offset = 0;
+        for (std::size_t& o : offsets) {
+            offset += std::exchange(o, offset);
+        }
+        for (const csv_cell& cell : cells) {
+            buffer[offsets[(key(cell) >> shift) & 0xffu]++] = cell;
+        }
+        cells.swap(buffer);
+    };
 
-    // Construct the cell reader object.
-    auto reader = traccc::io::csv::make_cell_reader(filename);
+    // Sort by the least significant key first.
+    for (unsigned int shift = 0; shift < 32; shift += 8) {
+        sort_by_digit([](const csv_cell& c) { return c.channel0; }, shift);
+    }
+    for (unsigned int shift = 0; shift < 32; shift += 8) {
+        sort_by_digit([](const csv_cell& c) { return c.channel1; }, shift);
+    }
+    for (unsigned int shift = 0; shift < 64; shift += 8) {
+        sort_by_digit([](const csv_cell& c) { return c.geometry_id; }, shift);
+    }
+}
 
-    // Read all cells from input file.
-    traccc::io::csv::cell iocell;
-    while (reader.read(iocell)) {
+/// Merge the duplicate cells of a sorted cell vector, summing up their values
+///
+/// The first cell of every group of duplicates is kept, with the values of
+/// the duplicates added to it in the order of the input file.
+void deduplicate_cells(std::vector<csv_cell>& cells,
+                       std::string_view filename) {
 
-        // Add the cell to the module. At this point the module link of the
-        // cells is not set up correctly yet.
-        result[iocell.geometry_id].push_back({iocell.channel0, iocell.channel1,
-                                              iocell.value, iocell.timestamp,
-                                              0});
+    std::size_t n_cells = 0;
+    unsigned int nduplicates = 0;
+    for (const csv_cell& cell : cells) {
+        if (n_cells > 0) {
+            csv_cell& previous = cells[n_cells - 1];
+            if ((previous.geometry_id == cell.geometry_id) &&
+                (previous.channel1 == cell.channel1) &&
+                (previous.channel0 == cell.channel0)) {
+                previous.value += cell.value;
+                ++nduplicates;
+                continue;
+            }
+        }
+        cells[n_cells++] = cell;
     }
+    cells.resize(n_cells);
 
-    // Sort the cells. Deduplication or not, they do need to be sorted.
-    for (auto& [_, cells] : result) {
-        std::sort(cells.begin(), cells.end(), ::cell_order());
+    if (nduplicates > 0) {
+        std::cout << "WARNING: @traccc::io::csv::read_cells: " << nduplicates
+                  << " duplicate cells found in " << filename << std::endl;
     }
-
-    // Return the container.
-    return result;
 }
 
 }  // namespace
@@ -174,12 +325,23 @@ void read_cells(
     const std::map<std::uint64_t, detray::geometry::barcode>* barcode_map,
     const bool deduplicate) {
 
-    // Get the cells and modules into an intermediate format.
-    auto cellsMap = (deduplicate ? read_deduplicated_cells(filename)
-                                 : read_all_cells(filename));
+    // Read the cells, and order them by module.
+    std::vector<csv_cell> cells = read_csv_cells(filename);
+    sort_cells(cells);
+    if (deduplicate) {
+        deduplicate_cells(cells, filename);
+    }
 
     // Fill the output containers with the ordered cells and modules.
-    for (const auto& [original_geometry_id, cells] : cellsMap) {
+    out.cells.reserve(out.cells.size() + cells.size());
+    for (std::size_t first = 0; first < cells.size();) {
+        const std::uint64_t original_geometry_id = cells[first].geometry_id;
+        std::size_t last = first;
+        while ((last < cells.size()) &&
+               (cells[last].geometry_id == original_geometry_id)) {
+            ++last;
+        }
+
         // Modify the geometry ID of the module if a barcode map is
         // provided.
         std::uint64_t geometry_id = original_geometry_id;
@@ -197,11 +359,14 @@ void read_cells(
         // Add the module and its cells to the output.
         out.modules.push_back(
             get_module(geometry_id, geom, dconfig, original_geometry_id));
-        for (auto& cell : cells) {
-            out.cells.push_back(cell);
-            // Set the module link.
-            out.cells.back().module_link = out.modules.size() - 1;
+        const cell::link_type module_link =
+            static_cast<cell::link_type>(out.modules.size() - 1);
+        for (std::size_t i = first; i < last; ++i) {
+            out.cells.push_back({cells[i].channel0, cells[i].channel1,
+                                 cells[i].value, cells[i].timestamp,
+                                 module_link});
         }
+        first = last;
     }
 }
 
@@ -28,6 +28,9 @@ std::ostream& operator<<(std::ostream& out, data_format format) {
         case data_format::obj:
             out << "wavefront obj";
             break;
+        case data_format::archive:
+            out << "binary archive";
+            break;
         default:
             out << "?!?unknown?!?";
             break;
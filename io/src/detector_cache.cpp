@@ -0,0 +1,569 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/detector_cache.hpp"
+
+#include "traccc/io/mapped_binary.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/utils.hpp"
+
+// Acts include(s).
+#include <Acts/Geometry/GeometryIdentifier.hpp>
+#include <Acts/Utilities/BinningData.hpp>
+
+// System include(s).
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @file
+///
+/// Layout of the detector cache files
+///
+/// A detector cache holds a @c traccc::io::detector_description in a form
+/// that can be used without any parsing:
+///  - A @c cache_header, at the beginning of the file;
+///  - The sections listed in the header, each one an array of standard
+///    layout elements, starting at a multiple of @c cache_alignment bytes.
+/// The header records the sizes of all element types, so that caches written
+/// on a platform with a different data layout are rejected. It also records
+/// the identity (size and modification time) of the source files, and the
+/// format of the geometry file. The absolute paths of the source files are
+/// stored in their own section.
+///
+
+namespace traccc::io {
+
+namespace {
+
+/// Alignment of all sections of a detector cache
+constexpr std::uint64_t cache_alignment = 64u;
+
+/// Identifier at the beginning of every detector cache
+constexpr std::array<char, 8> cache_magic = {'T', 'R', 'C', 'C',
+                                             'D', 'E', 'T', 'C'};
+
+/// Value used to detect caches written with a different byte order
+constexpr std::uint32_t cache_byte_order = 0x01020304u;
+
+/// Type of the nodes of the geometry's module map
+using geometry_node = geometry::module_map_node;
+
+/// Mapping of an Acts geometry identifier to a Detray barcode
+struct barcode_entry {
+    /// The Acts geometry identifier
+    std::uint64_t acts_id;
+    /// The (encoded) Detray barcode
+    std::uint64_t barcode;
+};
+
+/// The digitization configuration of one detector element
+struct digitization_entry {
+    /// The Acts geometry identifier of the element
+    std::uint64_t geometry_id;
+    /// Index of the first binning of the element's segmentation
+    std::uint32_t first_binning;
+    /// Number of binnings in the element's segmentation
+    std::uint32_t n_binnings;
+    /// Dimensions of the element's measurements
+    std::int32_t dimensions;
+    /// Variance of the element's measurements along the local y axis
+    float variance_y;
+};
+
+/// One binning of a segmentation
+struct binning_entry {
+    /// The binning type (equidistant or arbitrary)
+    std::int32_t type;
+    /// The binning option (open or closed)
+    std::int32_t option;
+    /// The binned value
+    std::int32_t value;
+    /// Number of bins
+    std::uint32_t bins;
+    /// Lower edge of the binning
+    float min;
+    /// Upper edge of the binning
+    float max;
+    /// Index of the first boundary of an arbitrary binning
+    std::uint32_t first_boundary;
+    /// Number of boundaries of an arbitrary binning
+    std::uint32_t n_boundaries;
+};
+
+/// The sections of a detector cache
+enum cache_section_kind : std::size_t {
+    nodes_section = 0,
+    transforms_section = 1,
+    barcodes_section = 2,
+    digitization_section = 3,
+    binnings_section = 4,
+    boundaries_section = 5,
+    source_paths_section = 6,
+    n_section_kinds = 7
+};
+
+/// Location of one section in a detector cache
+struct cache_section {
+    /// Offset of the section in the file
+    std::uint64_t offset = 0u;
+    /// Number of elements in the section
+    std::uint64_t size = 0u;
+};
+
+/// Identity of one source file of a detector cache
+struct source_identity {
+    /// The absolute path of the file
+    std::string path;
+    /// The size of the file
+    std::uint64_t size = 0u;
+    /// The last modification time of the file
+    std::int64_t mtime = 0;
+};
+
+/// Identity of all source files of a detector cache
+struct sources_identity {
+    /// The detector geometry file
+    source_identity detector;
+    /// The detector digitization file
+    source_identity digitization;
+    /// The format of the geometry file
+    data_format geometry_format = data_format::csv;
+};
+
+/// Get the identity of a source file
+///
+/// @param filename The name of the file, as given to the file readers
+/// @return The identity of the file
+/// @throw std::filesystem::filesystem_error If the file does not exist
+///
+source_identity get_source_identity(std::string_view filename) {
+
+    source_identity result;
+    result.path = get_absolute_path(filename);
+    result.size = static_cast<std::uint64_t>(
+        std::filesystem::file_size(result.path));
+    result.mtime = static_cast<std::int64_t>(
+        std::filesystem::last_write_time(result.path)
+            .time_since_epoch()
+            .count());
+    return result;
+}
+
+/// Get the identity of all source files of a detector cache
+sources_identity get_sources_identity(const detector_cache_sources& sources) {
+
+    return {get_source_identity(sources.detector_file),
+            get_source_identity(sources.digitization_file),
+            sources.geometry_format};
+}
+
+/// Header at the beginning of a detector cache
+struct cache_header {
+    /// Identifier of the file type
+    std::array<char, 8> magic = cache_magic;
+    /// Version of the cache layout
+    std::uint32_t version = detector_cache_version;
+    /// Marker of the byte order of the cache
+    std::uint32_t byte_order = cache_byte_order;
+    /// Whether the description has a barcode map
+    std::uint32_t has_barcode_map = 0u;
+    /// The format of the geometry file
+    std::int32_t geometry_format = 0;
+    /// Size of the geometry file
+    std::uint64_t detector_file_size = 0u;
+    /// Modification time of the geometry file
+    std::int64_t detector_file_mtime = 0;
+    /// Size of the digitization file
+    std::uint64_t digitization_file_size = 0u;
+    /// Modification time of the digitization file
+    std::int64_t digitization_file_mtime = 0;
+    /// Length of the geometry file's path, at the start of the source paths
+    std::uint64_t detector_path_length = 0u;
+    /// Sizes of the elements of the different kinds of sections
+    std::array<std::uint64_t, n_section_kinds> element_sizes = {
+        sizeof(geometry_node), sizeof(transform3),
+        sizeof(barcode_entry), sizeof(digitization_entry),
+        sizeof(binning_entry), sizeof(float),
+        sizeof(char)};
+    /// The sections of the cache
+    std::array<cache_section, n_section_kinds> sections;
+};
+
+/// Round up an offset to the alignment of the cache sections
+std::uint64_t cache_align(std::uint64_t offset) {
+    return (offset + cache_alignment - 1u) / cache_alignment *
+           cache_alignment;
+}
+
+/// Write one section of a detector cache
+///
+/// @param out The stream to write to, positioned after the previous section
+/// @param header The header to record the section's location in
+/// @param kind The kind of section to write
+/// @param items The elements of the section
+///
+template <typename T>
+void write_section(std::ofstream& out, cache_header& header,
+                   cache_section_kind kind, const std::vector<T>& items) {
+
+    // Make sure that the chosen type works.
+    static_assert(std::is_standard_layout_v<T>,
+                  "Section item type must have standard layout.");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Section item type must be trivially copyable.");
+
+    // Pad the file up to the alignment of the section.
+    const std::uint64_t position = static_cast<std::uint64_t>(out.tellp());
+    const std::uint64_t offset = cache_align(position);
+    static const std::array<char, cache_alignment> zeros{};
+    out.write(zeros.data(), static_cast<std::streamsize>(offset - position));
+    out.write(reinterpret_cast<const char*>(items.data()),
+              static_cast<std::streamsize>(items.size() * sizeof(T)));
+    header.sections[kind] = {offset, items.size()};
+}
+
+/// Read one section of a memory mapped detector cache
+///
+/// @param file The memory mapped cache
+/// @param header The (validated) header of the cache
+/// @param kind The kind of section to read
+/// @return The elements of the section
+///
+template <typename T>
+std::vector<T> read_section(const mapped_file& file,
+                            const cache_header& header,
+                            cache_section_kind kind) {
+
+    // Make sure that the chosen type works.
+    static_assert(std::is_standard_layout_v<T>,
+                  "Section item type must have standard layout.");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Section item type must be trivially copyable.");
+
+    const cache_section& section = header.sections[kind];
+    if ((section.offset > file.size()) ||
+        (section.size > (file.size() - section.offset) / sizeof(T))) {
+        throw std::runtime_error("Detector cache has a truncated section");
+    }
+    std::vector<T> result(section.size);
+    std::memcpy(result.data(), file.data() + section.offset,
+                section.size * sizeof(T));
+    return result;
+}
+
+/// Read and validate the header of a memory mapped detector cache
+///
+/// @param file The memory mapped cache
+/// @param filename The name of the cache file, for the error messages
+/// @return The header of the cache
+/// @throw std::runtime_error If the file is not a detector cache of the
+///                           current version and data layout
+///
+cache_header read_header(const mapped_file& file, std::string_view filename) {
+
+    cache_header header;
+    if (file.size() < sizeof(cache_header)) {
+        throw std::runtime_error("Detector cache " + std::string(filename) +
+                                 " is too small");
+    }
+    std::memcpy(&header, file.data(), sizeof(cache_header));
+    const cache_header expected;
+    if (header.magic != expected.magic) {
+        throw std::runtime_error("File " + std::string(filename) +
+                                 " is not a detector cache");
+    }
+    if (header.version != expected.version) {
+        throw std::runtime_error(
+            "Detector cache " + std::string(filename) + " has version " +
+            std::to_string(header.version) + ", expected version " +
+            std::to_string(expected.version));
+    }
+    if ((header.byte_order != expected.byte_order) ||
+        (header.element_sizes != expected.element_sizes)) {
+        throw std::runtime_error("Detector cache " + std::string(filename) +
+                                 " was written with a different data layout");
+    }
+    return header;
+}
+
+/// Write a detector description into a binary cache file
+///
+/// @param filename The name of the cache file to write (used as-is)
+/// @param desc The detector description to write
+/// @param sources The identity of the files that @c desc was read from
+///
+void write_cache(std::string_view filename, const detector_description& desc,
+                 const sources_identity& sources) {
+
+    // Collect the barcode map.
+    std::vector<barcode_entry> barcodes;
+    if (desc.barcode_map) {
+        barcodes.reserve(desc.barcode_map->size());
+        for (const auto& [acts_id, barcode] : *(desc.barcode_map)) {
+            barcodes.push_back({acts_id, barcode.value()});
+        }
+    }
+
+    // Flatten the digitization configuration.
+    std::vector<digitization_entry> digitization;
+    std::vector<binning_entry> binnings;
+    std::vector<float> boundaries;
+    digitization.reserve(desc.digi_cfg.size());
+    for (std::size_t i = 0; i < desc.digi_cfg.size(); ++i) {
+        const module_digitization_config& cfg = desc.digi_cfg.valueAt(i);
+        if (!cfg.segmentation.transform().isApprox(
+                Acts::Transform3::Identity())) {
+            throw std::invalid_argument(
+                "Transformed segmentations can not be written into a "
+                "detector cache");
+        }
+        const auto& binning_data = cfg.segmentation.binningData();
+        digitization.push_back(
+            {desc.digi_cfg.idAt(i).value(),
+             static_cast<std::uint32_t>(binnings.size()),
+             static_cast<std::uint32_t>(binning_data.size()),
+             static_cast<std::int32_t>(cfg.dimensions), cfg.variance_y});
+        for (const Acts::BinningData& data : binning_data) {
+            if (data.subBinningData) {
+                throw std::invalid_argument(
+                    "Sub-binnings can not be written into a detector cache");
+            }
+            binning_entry entry{static_cast<std::int32_t>(data.type),
+                                static_cast<std::int32_t>(data.option),
+                                static_cast<std::int32_t>(data.binvalue),
+                                static_cast<std::uint32_t>(data.bins()),
+                                data.min,
+                                data.max,
+                                static_cast<std::uint32_t>(boundaries.size()),
+                                0u};
+            if (data.type == Acts::arbitrary) {
+                const std::vector<float>& edges = data.boundaries();
+                entry.n_boundaries = static_cast<std::uint32_t>(edges.size());
+                boundaries.insert(boundaries.end(), edges.begin(),
+                                  edges.end());
+            }
+            binnings.push_back(entry);
+        }
+    }
+
+    // Write the cache into a temporary file first.
+    const std::string fname(filename);
+    const std::string tmp_fname =
+        fname + "." + std::to_string(::getpid()) + ".tmp";
+    {
+        std::ofstream out(tmp_fname, std::ios::binary);
+        if (!out) {
+            throw std::runtime_error("Failed to create detector cache file: " +
+                                     tmp_fname);
+        }
+        cache_header header;
+        header.has_barcode_map = (desc.barcode_map ? 1u : 0u);
+        header.geometry_format =
+            static_cast<std::int32_t>(sources.geometry_format);
+        header.detector_file_size = sources.detector.size;
+        header.detector_file_mtime = sources.detector.mtime;
+        header.digitization_file_size = sources.digitization.size;
+        header.digitization_file_mtime = sources.digitization.mtime;
+        header.detector_path_length = sources.detector.path.size();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        write_section(out, header, nodes_section,
+                      desc.surface_transforms.nodes());
+        write_section(out, header, transforms_section,
+                      desc.surface_transforms.values());
+        write_section(out, header, barcodes_section, barcodes);
+        write_section(out, header, digitization_section, digitization);
+        write_section(out, header, binnings_section, binnings);
+        write_section(out, header, boundaries_section, boundaries);
+        std::vector<char> source_paths(sources.detector.path.begin(),
+                                       sources.detector.path.end());
+        source_paths.insert(source_paths.end(),
+                            sources.digitization.path.begin(),
+                            sources.digitization.path.end());
+        write_section(out, header, source_paths_section, source_paths);
+
+        // Write the header again, now that it knows all the sections.
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if (!out) {
+            throw std::runtime_error("Failed to write detector cache file: " +
+                                     tmp_fname);
+        }
+    }
+    std::filesystem::rename(tmp_fname, fname);
+}
+
+}  // namespace
+
+void write_detector_cache(std::string_view filename,
+                          const detector_description& desc,
+                          const detector_cache_sources& sources) {
+
+    write_cache(filename, desc, get_sources_identity(sources));
+}
+
+bool detector_cache_is_valid(std::string_view filename,
+                             const detector_cache_sources& sources) {
+
+    if (std::filesystem::exists(std::filesystem::path(filename)) == false) {
+        return false;
+    }
+
+    try {
+        // Check that this is a cache that could be read.
+        const mapped_file file{filename};
+        const cache_header header = read_header(file, filename);
+
+        // Check that it was made from the same files.
+        const sources_identity current = get_sources_identity(sources);
+        const std::vector<char> source_paths =
+            read_section<char>(file, header, source_paths_section);
+        if (header.detector_path_length > source_paths.size()) {
+            return false;
+        }
+        const auto path_split =
+            source_paths.begin() +
+            static_cast<std::ptrdiff_t>(header.detector_path_length);
+        return (header.geometry_format ==
+                static_cast<std::int32_t>(current.geometry_format)) &&
+               (header.detector_file_size == current.detector.size) &&
+               (header.detector_file_mtime == current.detector.mtime) &&
+               (header.digitization_file_size == current.digitization.size) &&
+               (header.digitization_file_mtime ==
+                current.digitization.mtime) &&
+               (std::string(source_paths.begin(), path_split) ==
+                current.detector.path) &&
+               (std::string(path_split, source_paths.end()) ==
+                current.digitization.path);
+    } catch (const std::runtime_error&) {
+        // The file is not a detector cache that this code could use, or one
+        // of the source files does not exist.
+        return false;
+    }
+}
+
+detector_description read_detector_cache(std::string_view filename) {
+
+    // Map the file, and check its header.
+    const mapped_file file{filename};
+    const cache_header header = read_header(file, filename);
+
+    detector_description result;
+
+    // Set up the geometry.
+    result.surface_transforms =
+        geometry{read_section<geometry_node>(file, header, nodes_section),
+                 read_section<transform3>(file, header, transforms_section)};
+
+    // Set up the barcode map.
+    if (header.has_barcode_map != 0u) {
+        result.barcode_map = std::make_unique<
+            std::map<std::uint64_t, detray::geometry::barcode>>();
+        for (const barcode_entry& entry : read_section<barcode_entry>(
+                 file, header, barcodes_section)) {
+            result.barcode_map->emplace(
+                entry.acts_id, detray::geometry::barcode{entry.barcode});
+        }
+    }
+
+    // Set up the digitization configuration.
+    const std::vector<digitization_entry> digitization =
+        read_section<digitization_entry>(file, header, digitization_section);
+    const std::vector<binning_entry> binnings = read_section<binning_entry>(
+        file, header, binnings_section);
+    const std::vector<float> boundaries =
+        read_section<float>(file, header, boundaries_section);
+    std::vector<digitization_config::InputElement> elements;
+    elements.reserve(digitization.size());
+    for (const digitization_entry& entry : digitization) {
+        if ((entry.first_binning > binnings.size()) ||
+            (entry.n_binnings > binnings.size() - entry.first_binning)) {
+            throw std::runtime_error("Detector cache " +
+                                     std::string(filename) +
+                                     " has invalid binning indices");
+        }
+        module_digitization_config cfg;
+        cfg.dimensions = static_cast<char>(entry.dimensions);
+        cfg.variance_y = entry.variance_y;
+        for (std::uint32_t i = 0; i < entry.n_binnings; ++i) {
+            const binning_entry& binning = binnings[entry.first_binning + i];
+            const auto option =
+                static_cast<Acts::BinningOption>(binning.option);
+            const auto value = static_cast<Acts::BinningValue>(binning.value);
+            if (binning.type == static_cast<std::int32_t>(Acts::arbitrary)) {
+                if ((binning.first_boundary > boundaries.size()) ||
+                    (binning.n_boundaries >
+                     boundaries.size() - binning.first_boundary)) {
+                    throw std::runtime_error("Detector cache " +
+                                             std::string(filename) +
+                                             " has invalid bin boundaries");
+                }
+                const auto first = boundaries.begin() + binning.first_boundary;
+                const std::vector<float> edges(first,
+                                               first + binning.n_boundaries);
+                cfg.segmentation +=
+                    Acts::BinUtility(Acts::BinningData(option, value, edges));
+            } else {
+                cfg.segmentation += Acts::BinUtility(Acts::BinningData(
+                    option, value, binning.bins, binning.min, binning.max));
+            }
+        }
+        elements.emplace_back(Acts::GeometryIdentifier{entry.geometry_id},
+                              std::move(cfg));
+    }
+    result.digi_cfg = digitization_config{std::move(elements)};
+
+    return result;
+}
+
+detector_description read_detector_description(
+    std::string_view detector_file, std::string_view digitization_file,
+    data_format geometry_format, std::string_view cache_file) {
+
+    // Use the cache if it exists already, and is up to date.
+    const detector_cache_sources sources{std::string(detector_file),
+                                         std::string(digitization_file),
+                                         geometry_format};
+    if ((cache_file.empty() == false) &&
+        detector_cache_is_valid(cache_file, sources)) {
+        return read_detector_cache(cache_file);
+    }
+
+    // Take the identity of the source files before reading them, so that a
+    // cache would never claim to hold a newer version of them.
+    sources_identity identity;
+    if (cache_file.empty() == false) {
+        identity = get_sources_identity(sources);
+    }
+
+    // Read the description from the source files.
+    detector_description result;
+    auto geom_pair = read_geometry(detector_file, geometry_format);
+    result.surface_transforms = std::move(geom_pair.first);
+    result.barcode_map = std::move(geom_pair.second);
+    result.digi_cfg = read_digitization_config(digitization_file);
+
+    // Write it into the cache, if one was requested.
+    if (cache_file.empty() == false) {
+        write_cache(cache_file, result, identity);
+    }
+
+    return result;
+}
+
+}  // namespace traccc::io
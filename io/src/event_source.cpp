@@ -0,0 +1,193 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/event_source.hpp"
+
+#include "traccc/io/detector_cache.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+namespace traccc::io {
+
+event_source::event_source(const config& cfg, vecmem::memory_resource& mr)
+    : m_cfg(cfg), m_mr(mr) {
+
+    // Check the configuration.
+    if (m_cfg.input_events == 0u) {
+        throw std::invalid_argument("No input events to read");
+    }
+    m_cfg.prefetch = std::max<std::size_t>(m_cfg.prefetch, 1u);
+    m_cfg.reader_threads = std::max<std::size_t>(m_cfg.reader_threads, 1u);
+
+    // Set up the objects needed for reading the events once, up front.
+    if (m_cfg.event_format == data_format::archive) {
+        m_archive = std::make_unique<mapped_file>(get_absolute_path(
+            (std::filesystem::path(m_cfg.directory) /
+             std::filesystem::path(get_archive_filename()))
+                .native()));
+    } else {
+        detector_description detector = read_detector_description(
+            m_cfg.detector_file, m_cfg.digitization_file,
+            m_cfg.geometry_format, m_cfg.detector_cache_file);
+        m_geometry = std::move(detector.surface_transforms);
+        m_barcode_map = std::move(detector.barcode_map);
+        m_digi_cfg = std::move(detector.digi_cfg);
+    }
+
+    // Start the reader threads, if requested.
+    if (m_cfg.start_reading) {
+        start();
+    }
+}
+
+event_source::~event_source() {
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+    m_slot_free.notify_all();
+    for (std::thread& reader : m_readers) {
+        reader.join();
+    }
+}
+
+void event_source::start() {
+
+    std::lock_guard lock(m_mutex);
+    start_readers();
+}
+
+std::unique_ptr<event_source::event_type> event_source::next() {
+
+    std::unique_lock lock(m_mutex);
+    start_readers();
+
+    // Wait for an event to become available, if there isn't one already.
+    auto event_available = [this]() {
+        return (m_queue.empty() == false) || m_error ||
+               (m_delivered == m_cfg.events);
+    };
+    if (event_available() == false) {
+        const auto start = std::chrono::steady_clock::now();
+        m_event_ready.wait(lock, event_available);
+        m_wait_time += std::chrono::steady_clock::now() - start;
+    }
+
+    // Forward errors from the reader threads, once the events read
+    // successfully were consumed.
+    if (m_queue.empty()) {
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+        return nullptr;
+    }
+
+    // Hand over the next event.
+    std::unique_ptr<event_type> result = std::move(m_queue.front());
+    m_queue.pop_front();
+    ++m_delivered;
+    lock.unlock();
+    m_slot_free.notify_one();
+    return result;
+}
+
+void event_source::wait_for_prefetch() {
+
+    std::unique_lock lock(m_mutex);
+    start_readers();
+    m_event_ready.wait(lock, [this]() {
+        return (m_queue.size() >= m_cfg.prefetch) || m_error ||
+               (m_delivered + m_queue.size() == m_cfg.events);
+    });
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+}
+
+std::chrono::nanoseconds event_source::wait_time() const {
+
+    std::lock_guard lock(m_mutex);
+    return m_wait_time;
+}
+
+void event_source::start_readers() {
+
+    if (m_readers.empty() == false) {
+        return;
+    }
+    m_readers.reserve(m_cfg.reader_threads);
+    for (std::size_t i = 0; i < m_cfg.reader_threads; ++i) {
+        m_readers.emplace_back([this]() { read_events(); });
+    }
+}
+
+void event_source::read_events() {
+
+    while (true) {
+
+        // Claim the next event to read, once there is room for it.
+        std::size_t event = 0u;
+        {
+            std::unique_lock lock(m_mutex);
+            m_slot_free.wait(lock, [this]() {
+                return m_stop || m_error ||
+                       (m_queue.size() + m_reading < m_cfg.prefetch);
+            });
+            if (m_stop || m_error || (m_scheduled == m_cfg.events)) {
+                return;
+            }
+            event = m_scheduled++ % m_cfg.input_events;
+            ++m_reading;
+        }
+
+        // Read the event without holding the lock.
+        auto result = std::make_unique<event_type>(&m_mr);
+        std::exception_ptr error;
+        try {
+            read_event(*result, event);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // Publish the event, or the error.
+        {
+            std::lock_guard lock(m_mutex);
+            --m_reading;
+            if (error) {
+                if (!m_error) {
+                    m_error = error;
+                }
+            } else {
+                m_queue.push_back(std::move(result));
+            }
+        }
+        m_event_ready.notify_all();
+        if (error) {
+            m_slot_free.notify_all();
+            return;
+        }
+    }
+}
+
+void event_source::read_event(event_type& out, std::size_t event) const {
+
+    if (m_archive) {
+        read_cells(out, event, *m_archive);
+    } else {
+        read_cells(out, event, m_cfg.directory, m_cfg.event_format,
+                   &m_geometry, &m_digi_cfg, m_barcode_map.get());
+    }
+}
+
+}  // namespace traccc::io
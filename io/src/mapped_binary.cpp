@@ -0,0 +1,128 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/mapped_binary.hpp"
+
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace traccc::io {
+
+namespace {
+
+/// Get the full name of an event's data file
+std::string event_file(std::size_t event, std::string_view directory,
+                       std::string_view suffix) {
+
+    return get_absolute_path(
+        (std::filesystem::path(directory) /
+         std::filesystem::path(get_event_filename(event, suffix)))
+            .native());
+}
+
+}  // namespace
+
+mapped_file::mapped_file(std::string_view filename) {
+
+    // Open the file.
+    const std::string fname(filename);
+    const int fd = ::open(fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open file: " + fname + " (" +
+                                 std::strerror(errno) + ")");
+    }
+
+    // Find its size.
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        const int error = errno;
+        ::close(fd);
+        throw std::runtime_error("Failed to query file: " + fname + " (" +
+                                 std::strerror(error) + ")");
+    }
+    m_size = static_cast<std::size_t>(st.st_size);
+
+    // Map it. (Empty files can not be mapped, they are left without data.)
+    if (m_size > 0u) {
+        void* ptr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) {
+            const int error = errno;
+            ::close(fd);
+            throw std::runtime_error("Failed to map file: " + fname + " (" +
+                                     std::strerror(error) + ")");
+        }
+        m_data = static_cast<const unsigned char*>(ptr);
+    }
+
+    // The mapping stays valid without the file descriptor.
+    ::close(fd);
+}
+
+mapped_file::mapped_file(mapped_file&& parent) noexcept
+    : m_data(std::exchange(parent.m_data, nullptr)),
+      m_size(std::exchange(parent.m_size, 0u)) {}
+
+mapped_file::~mapped_file() {
+
+    if (m_data != nullptr) {
+        ::munmap(const_cast<unsigned char*>(m_data), m_size);
+    }
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept {
+
+    if (this != &rhs) {
+        if (m_data != nullptr) {
+            ::munmap(const_cast<unsigned char*>(m_data), m_size);
+        }
+        m_data = std::exchange(rhs.m_data, nullptr);
+        m_size = std::exchange(rhs.m_size, 0u);
+    }
+    return *this;
+}
+
+mapped_cell_reader_output map_cells(std::size_t event,
+                                    std::string_view directory) {
+
+    return {mapped_collection<cell>{
+                event_file(event, directory, "-cells.dat")},
+            mapped_collection<cell_module>{
+                event_file(event, directory, "-modules.dat")}};
+}
+
+mapped_measurement_reader_output map_measurements(std::size_t event,
+                                                  std::string_view directory) {
+
+    return {mapped_collection<measurement>{
+                event_file(event, directory, "-measurements.dat")},
+            mapped_collection<cell_module>{
+                event_file(event, directory, "-modules.dat")}};
+}
+
+mapped_spacepoint_reader_output map_spacepoints(std::size_t event,
+                                                std::string_view directory) {
+
+    return {mapped_collection<spacepoint>{
+                event_file(event, directory, "-hits.dat")},
+            mapped_collection<cell_module>{
+                event_file(event, directory, "-modules.dat")}};
+}
+
+}  // namespace traccc::io
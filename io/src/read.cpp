@@ -8,9 +8,13 @@
 // Local include(s).
 #include "traccc/io/read.hpp"
 
+#include "traccc/io/detector_cache.hpp"
 #include "traccc/io/read_cells.hpp"
-#include "traccc/io/read_digitization_config.hpp"
-#include "traccc/io/read_geometry.hpp"
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <cassert>
+#include <filesystem>
 
 // OpenMP include(s).
 #ifdef _OPENMP
@@ -22,19 +26,31 @@ namespace traccc::io {
 void read(demonstrator_input& out, std::size_t events,
           std::string_view directory, std::string_view detector_file,
           std::string_view digi_config_file, data_format event_format,
-          data_format geometry_format) {
-
-    // Read in the detector configuration. We can't use structured bindings for
-    // the return value of read_geometry(...), because the old Intel compiler
-    // used in the CI, when using OpenMP, crashes on such code. :-(
-    const auto geom_pair = io::read_geometry(detector_file, geometry_format);
-    const auto& geom = geom_pair.first;
-    const digitization_config digi_cfg =
-        io::read_digitization_config(digi_config_file);
-    const auto& barcode_map = geom_pair.second;
+          data_format geometry_format,
+          std::string_view detector_cache_file) {
 
     assert(out.size() >= events);
 
+    // Read the events of an archive from a single mapping of it.
+    if (event_format == data_format::archive) {
+        const mapped_file archive{get_absolute_path(
+            (std::filesystem::path(directory) /
+             std::filesystem::path(get_archive_filename()))
+                .native())};
+#pragma omp parallel for
+        for (std::size_t event = 0; event < events; ++event) {
+            io::read_cells(out[event], event, archive);
+        }
+        return;
+    }
+
+    // Read in the detector configuration.
+    const detector_description detector = io::read_detector_description(
+        detector_file, digi_config_file, geometry_format, detector_cache_file);
+    const geometry& geom = detector.surface_transforms;
+    const digitization_config& digi_cfg = detector.digi_cfg;
+    const auto& barcode_map = detector.barcode_map;
+
     // Read in the cell data for all events. In parallel if possible.
 #pragma omp parallel for
     for (std::size_t event = 0; event < events; ++event) {
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,7 +12,11 @@
 
 // System include(s).
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
 #include <fstream>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <vector>
@@ -23,6 +27,8 @@ namespace traccc::io::details {
 ///
 /// @param filename The full input filename
 /// @param mr Is the memory resource to create the result container with
+/// @throw std::runtime_error If the file could not be opened, or if its size
+///                           does not match the container that it describes
 ///
 /// TODO: Change container reading to not own its result object
 template <typename container_t>
@@ -37,15 +43,52 @@ container_t read_binary_container(std::string_view filename,
 
     // Open the input file.
     std::ifstream in_file(filename.data(), std::ios::binary);
+    if (!in_file.is_open()) {
+        throw std::runtime_error("Failed to open file: " +
+                                 std::string(filename));
+    }
+
+    // Helper function for reporting an invalid file.
+    auto invalid_file = [&filename]() {
+        return std::runtime_error("File " + std::string(filename) +
+                                  " does not hold a valid container");
+    };
 
     // Read the size of the header vector.
-    std::size_t headers_size;
+    const std::uintmax_t file_size = std::filesystem::file_size(filename);
+    std::size_t headers_size = 0;
     in_file.read(reinterpret_cast<char*>(&headers_size), sizeof(std::size_t));
+    if (!in_file) {
+        throw invalid_file();
+    }
+    std::uintmax_t payload_size = file_size - sizeof(std::size_t);
 
     // Read the sizes of the item vector.
+    constexpr std::size_t header_size =
+        sizeof(std::size_t) + sizeof(typename container_t::header_type);
+    if (headers_size > payload_size / header_size) {
+        throw invalid_file();
+    }
     std::vector<std::size_t> items_size(headers_size);
     in_file.read(reinterpret_cast<char*>(items_size.data()),
                  headers_size * sizeof(typename std::size_t));
+    if (!in_file) {
+        throw invalid_file();
+    }
+    payload_size -= headers_size * header_size;
+
+    // Make sure that the file holds exactly the container.
+    constexpr std::size_t item_size =
+        sizeof(typename container_t::item_type);
+    for (std::size_t size : items_size) {
+        if (size > payload_size / item_size) {
+            throw invalid_file();
+        }
+        payload_size -= size * item_size;
+    }
+    if (payload_size != 0u) {
+        throw invalid_file();
+    }
 
     // Create the result container, and set it to the correct (outer) size right
     // away.
@@ -62,6 +105,9 @@ container_t read_binary_container(std::string_view filename,
             reinterpret_cast<char*>(result.get_items().at(i).data()),
             items_size.at(i) * sizeof(typename container_t::item_type));
     }
+    if (!in_file) {
+        throw invalid_file();
+    }
 
     // Return the newly created container.
     return result;
@@ -81,11 +127,27 @@ void read_binary_collection(collection_t& result, std::string_view filename) {
 
     // Open the input file.
     std::ifstream in_file(filename.data(), std::ios::binary);
+    if (!in_file.is_open()) {
+        throw std::runtime_error("Failed to open file: " +
+                                 std::string(filename));
+    }
 
     // Read the size of the header vector.
-    std::size_t size;
+    std::size_t size = 0;
     in_file.read(reinterpret_cast<char*>(&size), sizeof(std::size_t));
 
+    // Make sure that the file holds exactly the collection.
+    const std::uintmax_t payload_size =
+        std::filesystem::file_size(filename) - sizeof(std::size_t);
+    constexpr std::size_t item_size =
+        sizeof(typename collection_t::value_type);
+    if (!in_file || (size > payload_size / item_size) ||
+        (size * item_size != payload_size)) {
+        throw std::runtime_error("File " + std::string(filename) +
+                                 " does not hold a valid collection of " +
+                                 std::to_string(size) + " elements");
+    }
+
     // Set result to the correct size.
     result.resize(size);
 
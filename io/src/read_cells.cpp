@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/io/read_cells.hpp"
 
+#include "archive.hpp"
 #include "csv/read_cells.hpp"
 #include "read_binary.hpp"
 #include "traccc/io/utils.hpp"
@@ -50,6 +51,14 @@ void read_cells(
                                       .native()));
             break;
         }
+        case data_format::archive: {
+            read_cells(out, event,
+                       mapped_file{get_absolute_path(
+                           (std::filesystem::path(directory) /
+                            std::filesystem::path(get_archive_filename()))
+                               .native())});
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -71,4 +80,17 @@ void read_cells(
     }
 }
 
+void read_cells(cell_reader_output& out, std::size_t event,
+                const mapped_file& archive) {
+
+    const details::archive_event entry =
+        details::read_archive_event(archive, event);
+    details::read_archive_section(archive, entry,
+                                  details::archive_section_kind::cells,
+                                  out.cells);
+    details::read_archive_section(archive, entry,
+                                  details::archive_section_kind::modules,
+                                  out.modules);
+}
+
 }  // namespace traccc::io
@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/io/read_measurements.hpp"
 
+#include "archive.hpp"
 #include "csv/read_measurements.hpp"
 #include "read_binary.hpp"
 #include "traccc/io/utils.hpp"
@@ -49,6 +50,21 @@ void read_measurements(
                                       .native()));
             break;
         }
+        case data_format::archive: {
+            const mapped_file archive{get_absolute_path(
+                (std::filesystem::path(directory) /
+                 std::filesystem::path(get_archive_filename()))
+                    .native())};
+            const details::archive_event entry =
+                details::read_archive_event(archive, event);
+            details::read_archive_section(
+                archive, entry, details::archive_section_kind::measurements,
+                out.measurements);
+            details::read_archive_section(
+                archive, entry, details::archive_section_kind::modules,
+                out.modules);
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
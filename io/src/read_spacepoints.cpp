@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/io/read_spacepoints.hpp"
 
+#include "archive.hpp"
 #include "csv/read_spacepoints.hpp"
 #include "read_binary.hpp"
 #include "traccc/io/utils.hpp"
@@ -55,6 +56,21 @@ void read_spacepoints(spacepoint_reader_output& out, std::size_t event,
                                       .native()));
             break;
         }
+        case data_format::archive: {
+            const mapped_file archive{get_absolute_path(
+                (std::filesystem::path(directory) /
+                 std::filesystem::path(get_archive_filename()))
+                    .native())};
+            const details::archive_event entry =
+                details::read_archive_event(archive, event);
+            details::read_archive_section(
+                archive, entry, details::archive_section_kind::spacepoints,
+                out.spacepoints);
+            details::read_archive_section(
+                archive, entry, details::archive_section_kind::modules,
+                out.modules);
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -42,6 +42,11 @@ std::string get_event_filename(std::size_t event, std::string_view suffix) {
     return stream.str();
 }
 
+std::string get_archive_filename() {
+
+    return "event-archive.dat";
+}
+
 std::string get_absolute_path(std::string_view path) {
 
     // Check if the path is already absolute.
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023 CERN for the benefit of the ACTS project
+ * (c) 2023-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -69,6 +69,12 @@ class finding_performance_writer {
     void write(const track_state_container_types::const_view& track_states_view,
                const event_map2& evt_map);
 
+    void write(const compact_track_candidate_container_types::const_view&
+                   track_candidates_view,
+               const measurement_collection_types::const_view&
+                   measurements_view,
+               const event_map2& evt_map);
+
     void finalize();
 
     private:
@@ -0,0 +1,83 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::performance {
+
+/// Histogram of latencies, with logarithmic buckets
+///
+/// The histogram uses the bucketing scheme of HDR histograms. Every power of
+/// two is split into @c sub_buckets linear buckets, so the values are stored
+/// with a relative precision of better than 1%, over the full range of
+/// 64-bit nanosecond values.
+///
+/// Recording values is thread safe, and lock-free.
+///
+class latency_histogram {
+
+    public:
+    /// Number of bits used for the linear buckets inside each power of two
+    static constexpr unsigned int sub_bucket_bits = 7u;
+    /// Number of linear buckets inside each power of two
+    static constexpr std::uint64_t sub_buckets = 1u << sub_bucket_bits;
+    /// Total number of buckets
+    static constexpr std::size_t n_buckets =
+        (64u - sub_bucket_bits + 1u) * sub_buckets;
+
+    /// Default constructor, creating an empty histogram
+    latency_histogram();
+
+    /// No copy constructor
+    latency_histogram(const latency_histogram&) = delete;
+    /// No copy assignment
+    latency_histogram& operator=(const latency_histogram&) = delete;
+
+    /// Record one latency measurement (thread safe)
+    void record(std::chrono::nanoseconds latency);
+    /// Remove all measurements from the histogram
+    void reset();
+
+    /// Get the number of recorded measurements
+    std::size_t count() const;
+    /// Get the mean of the recorded measurements
+    std::chrono::nanoseconds mean() const;
+    /// Get the largest recorded measurement
+    std::chrono::nanoseconds max() const;
+    /// Get a percentile of the recorded measurements
+    ///
+    /// @param percent The percentile to get, in the <tt>[0, 100]</tt> range
+    /// @return The (highest equivalent) value of the bucket holding the
+    ///         requested percentile, or zero for an empty histogram
+    ///
+    std::chrono::nanoseconds percentile(double percent) const;
+
+    /// Get the bucket index of a value
+    static std::size_t bucket_index(std::uint64_t value);
+    /// Get the highest value belonging to a bucket
+    static std::uint64_t bucket_max_value(std::size_t index);
+
+    private:
+    /// The bucket counts
+    std::array<std::atomic<std::uint64_t>, n_buckets> m_buckets;
+    /// The number of recorded measurements
+    std::atomic<std::uint64_t> m_count;
+    /// The sum of the recorded measurements
+    std::atomic<std::uint64_t> m_sum;
+    /// The largest recorded measurement
+    std::atomic<std::uint64_t> m_max;
+
+};  // class latency_histogram
+
+}  // namespace traccc::performance
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -44,4 +44,57 @@ class timer {
     timing_info& m_timing_info;
 };  // class timer
 
+/// Object used for measuring the latency of a single execution of something
+///
+/// Like @c traccc::performance::timer, but recording the elapsed time into
+/// the latency histogram of the component, in a thread safe way.
+///
+class latency_timer {
+
+    public:
+    /// Start time measurement
+    /// @param timer_name name to be printed out identifying what is measured
+    /// @param t_info timing_info where to record the latency
+    latency_timer(const std::string_view timer_name, timing_info& t_info);
+    /// End time measurement
+    ~latency_timer();
+
+    private:
+    /// Start time (measured at construct time)
+    std::chrono::high_resolution_clock::time_point m_start;
+    /// Name of measurement
+    std::string m_name;
+    /// Timing info where to record the latency
+    timing_info& m_timing_info;
+
+};  // class latency_timer
+
+/// Object used for measuring the latencies of consecutive processing stages
+///
+/// Every call to @c next(...) records the time elapsed since the previous
+/// call (or since construction) as the latency of the named stage. Nothing
+/// is measured if no timing info is given.
+///
+class stage_timer {
+
+    public:
+    /// Start time measurement
+    /// @param t_info timing_info where to record the latencies, may be null
+    explicit stage_timer(timing_info* t_info);
+
+    /// Check whether the latencies are being measured
+    bool enabled() const { return m_timing_info != nullptr; }
+
+    /// Finish the measurement of a stage, and start the next one
+    /// @param stage_name name identifying the stage that just finished
+    void next(const std::string_view stage_name);
+
+    private:
+    /// Start time of the current stage
+    std::chrono::high_resolution_clock::time_point m_start;
+    /// Timing info where to record the latencies
+    timing_info* m_timing_info;
+
+};  // class stage_timer
+
 }  // namespace traccc::performance
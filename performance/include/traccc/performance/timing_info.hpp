@@ -1,15 +1,21 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #pragma once
 
+// Project include(s).
+#include "traccc/performance/latency_histogram.hpp"
+
 // System include(s).
 #include <chrono>
 #include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -19,8 +25,16 @@ namespace traccc::performance {
 /// Helper type used for timing information storage
 using timing_info_pair = std::pair<std::string, std::chrono::nanoseconds>;
 
+/// Helper type used for latency histogram storage
+using latency_info_pair =
+    std::pair<std::string, std::unique_ptr<latency_histogram>>;
+
 /// Struct for storing time measurements collected in timer class
 ///
+/// Besides the total times of the components, it can also hold histograms of
+/// their (per-event) latencies. Recording latencies is thread safe, recording
+/// the total times is not.
+///
 struct timing_info {
 
     /// The low level data.
@@ -33,9 +47,68 @@ struct timing_info {
     ///
     std::chrono::nanoseconds get_time(std::string_view timer_name) const;
 
+    /// Record one latency measurement of a given component (thread safe)
+    ///
+    /// @param timer_name The name of the component
+    /// @param latency The time taken by one execution of the component
+    ///
+    void record_latency(std::string_view timer_name,
+                        std::chrono::nanoseconds latency);
+
+    /// Get the latency histogram of a given component
+    ///
+    /// @param timer_name The name of the component
+    /// @return The latency histogram of the component in question
+    ///
+    const latency_histogram& get_latency(std::string_view timer_name) const;
+
+    /// Get the latency histograms of all components
+    ///
+    /// The histograms are in the order in which the components were first
+    /// recorded. Must not be called while latencies are being recorded.
+    ///
+    const std::vector<latency_info_pair>& latencies() const {
+        return m_latencies;
+    }
+
+    /// Remove all measurements from the latency histograms
+    void reset_latencies();
+
+    private:
+    /// Mutex protecting the latency histogram list
+    mutable std::mutex m_latency_mutex;
+    /// Latency histograms of the components
+    std::vector<latency_info_pair> m_latencies;
+
 };  // struct timing_info
 
 /// Printout helper for @c traccc::performance::timing_info
 std::ostream& operator<<(std::ostream& out, const timing_info& info);
 
+/// Print the latency percentiles of all components
+///
+/// @param out The stream to print to
+/// @param info The timing information to print the latencies of
+///
+void print_latencies(std::ostream& out, const timing_info& info);
+
+/// Write the latency percentiles of all components in JSON format
+///
+/// @param out The stream to write to
+/// @param info The timing information to write the latencies of
+///
+void write_latencies_json(std::ostream& out, const timing_info& info);
+
+/// Write the latency percentiles of all components in CSV format
+///
+/// Every component is written in a separate line, with the columns
+/// <tt>name,count,mean,p50,p90,p99,max</tt>, all times in nanoseconds.
+///
+/// @param out The stream to write to
+/// @param info The timing information to write the latencies of
+/// @param prefix Columns to write at the beginning of every line
+///
+void write_latencies_csv(std::ostream& out, const timing_info& info,
+                         std::string_view prefix = "");
+
 }  // namespace traccc::performance
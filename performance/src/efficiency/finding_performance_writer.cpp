@@ -103,6 +103,44 @@ std::vector<std::vector<measurement>> prepare_data(
     return result;
 }
 
+/**
+ * @brief For compact track candidates. Associates each reconstructed track
+ * with its measurements.
+ *
+ * @param track_candidates_view the compact track candidates found by the
+ * finding algorithm.
+ * @param measurements_view the measurements referred to by the candidates.
+ * @return std::vector<std::vector<measurement>> Associates each track index
+ * with its corresponding measurements.
+ */
+std::vector<std::vector<measurement>> prepare_data(
+    const compact_track_candidate_container_types::const_view&
+        track_candidates_view,
+    const measurement_collection_types::const_view& measurements_view) {
+    std::vector<std::vector<measurement>> result;
+
+    // Iterate over the tracks.
+    compact_track_candidate_container_types::const_device track_candidates(
+        track_candidates_view);
+    measurement_collection_types::const_device all_measurements(
+        measurements_view);
+
+    const unsigned int n_tracks = track_candidates.size();
+    result.reserve(n_tracks);
+
+    for (unsigned int i = 0; i < n_tracks; i++) {
+        const auto& cands = track_candidates.at(i).items;
+
+        std::vector<measurement> measurements;
+        measurements.reserve(cands.size());
+        for (const auto& cand : cands) {
+            measurements.push_back(cand.get_measurement(all_measurements));
+        }
+        result.push_back(std::move(measurements));
+    }
+    return result;
+}
+
 /**
  * @brief For ambiguity resolution only. Associates each reconstructed track
  * with its measurements.
@@ -236,6 +274,17 @@ void finding_performance_writer::write(
     write_common(tracks, evt_map);
 }
 
+/// For compact track candidates
+void finding_performance_writer::write(
+    const compact_track_candidate_container_types::const_view&
+        track_candidates_view,
+    const measurement_collection_types::const_view& measurements_view,
+    const event_map2& evt_map) {
+    std::vector<std::vector<measurement>> tracks =
+        prepare_data(track_candidates_view, measurements_view);
+    write_common(tracks, evt_map);
+}
+
 void finding_performance_writer::finalize() {
 
 #ifdef TRACCC_HAVE_ROOT
@@ -0,0 +1,124 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/latency_histogram.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+
+namespace traccc::performance {
+
+latency_histogram::latency_histogram() {
+
+    reset();
+}
+
+void latency_histogram::record(std::chrono::nanoseconds latency) {
+
+    const std::uint64_t value =
+        static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+
+    m_buckets[bucket_index(value)].fetch_add(1u, std::memory_order_relaxed);
+    m_count.fetch_add(1u, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    std::uint64_t current_max = m_max.load(std::memory_order_relaxed);
+    while ((value > current_max) &&
+           (m_max.compare_exchange_weak(current_max, value,
+                                        std::memory_order_relaxed) == false)) {
+    }
+}
+
+void latency_histogram::reset() {
+
+    for (std::atomic<std::uint64_t>& bucket : m_buckets) {
+        bucket.store(0u, std::memory_order_relaxed);
+    }
+    m_count.store(0u, std::memory_order_relaxed);
+    m_sum.store(0u, std::memory_order_relaxed);
+    m_max.store(0u, std::memory_order_relaxed);
+}
+
+std::size_t latency_histogram::count() const {
+
+    return m_count.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds latency_histogram::mean() const {
+
+    const std::uint64_t n = m_count.load(std::memory_order_relaxed);
+    if (n == 0u) {
+        return std::chrono::nanoseconds{0};
+    }
+    return std::chrono::nanoseconds{
+        static_cast<std::int64_t>(m_sum.load(std::memory_order_relaxed) / n)};
+}
+
+std::chrono::nanoseconds latency_histogram::max() const {
+
+    return std::chrono::nanoseconds{
+        static_cast<std::int64_t>(m_max.load(std::memory_order_relaxed))};
+}
+
+std::chrono::nanoseconds latency_histogram::percentile(double percent) const {
+
+    const std::uint64_t n = m_count.load(std::memory_order_relaxed);
+    if (n == 0u) {
+        return std::chrono::nanoseconds{0};
+    }
+
+    // The rank of the requested measurement, counting from 1.
+    const std::uint64_t rank = std::clamp<std::uint64_t>(
+        static_cast<std::uint64_t>(
+            std::ceil(std::clamp(percent, 0., 100.) * 0.01 * n)),
+        1u, n);
+
+    // Find the bucket holding that measurement.
+    std::uint64_t seen = 0u;
+    for (std::size_t i = 0; i < n_buckets; ++i) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::chrono::nanoseconds{static_cast<std::int64_t>(
+                std::min(bucket_max_value(i),
+                         m_max.load(std::memory_order_relaxed)))};
+        }
+    }
+    return max();
+}
+
+std::size_t latency_histogram::bucket_index(std::uint64_t value) {
+
+    // Small values are stored in linear buckets.
+    if (value < sub_buckets) {
+        return static_cast<std::size_t>(value);
+    }
+
+    // Larger values are stored in the linear sub-buckets of their power of
+    // two.
+    unsigned int exponent = 0u;
+    for (std::uint64_t v = value >> 1u; v != 0u; v >>= 1u) {
+        ++exponent;
+    }
+    const unsigned int shift = exponent - sub_bucket_bits;
+    return static_cast<std::size_t>(((shift + 1u) << sub_bucket_bits) +
+                                    ((value >> shift) - sub_buckets));
+}
+
+std::uint64_t latency_histogram::bucket_max_value(std::size_t index) {
+
+    const std::uint64_t block = index >> sub_bucket_bits;
+    const std::uint64_t sub = index & (sub_buckets - 1u);
+    if (block == 0u) {
+        return sub;
+    }
+    const std::uint64_t shift = block - 1u;
+    return ((sub_buckets + sub) << shift) + ((std::uint64_t{1} << shift) - 1u);
+}
+
+}  // namespace traccc::performance
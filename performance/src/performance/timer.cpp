@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -50,4 +50,33 @@ timer::~timer() {
     }
 }
 
+latency_timer::latency_timer(const std::string_view timer_name,
+                             timing_info& t_info)
+    : m_start(std::chrono::high_resolution_clock::now()),
+      m_name(timer_name),
+      m_timing_info(t_info) {}
+
+latency_timer::~latency_timer() {
+
+    const auto end = std::chrono::high_resolution_clock::now();
+    m_timing_info.record_latency(m_name, end - m_start);
+}
+
+stage_timer::stage_timer(timing_info* t_info) : m_timing_info(t_info) {
+
+    if (m_timing_info != nullptr) {
+        m_start = std::chrono::high_resolution_clock::now();
+    }
+}
+
+void stage_timer::next(const std::string_view stage_name) {
+
+    if (m_timing_info == nullptr) {
+        return;
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    m_timing_info->record_latency(stage_name, end - m_start);
+    m_start = end;
+}
+
 }  // namespace traccc::performance
@@ -10,6 +10,7 @@
 
 // System include(s).
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <iostream>
 #include <stdexcept>
@@ -29,6 +30,50 @@ std::chrono::nanoseconds timing_info::get_time(
     return it->second;
 }
 
+void timing_info::record_latency(std::string_view timer_name,
+                                 std::chrono::nanoseconds latency) {
+
+    latency_histogram* histogram = nullptr;
+    {
+        std::lock_guard lock(m_latency_mutex);
+        auto it = std::find_if(m_latencies.begin(), m_latencies.end(),
+                               [&timer_name](const latency_info_pair& itr) {
+                                   return itr.first == timer_name;
+                               });
+        if (it == m_latencies.end()) {
+            m_latencies.push_back({std::string{timer_name},
+                                   std::make_unique<latency_histogram>()});
+            histogram = m_latencies.back().second.get();
+        } else {
+            histogram = it->second.get();
+        }
+    }
+    // The histograms themselves are thread safe.
+    histogram->record(latency);
+}
+
+const latency_histogram& timing_info::get_latency(
+    std::string_view timer_name) const {
+
+    std::lock_guard lock(m_latency_mutex);
+    auto it = std::find_if(m_latencies.begin(), m_latencies.end(),
+                           [&timer_name](const latency_info_pair& itr) {
+                               return itr.first == timer_name;
+                           });
+    if (it == m_latencies.end()) {
+        throw std::invalid_argument("Unknown component name received");
+    }
+    return *(it->second);
+}
+
+void timing_info::reset_latencies() {
+
+    std::lock_guard lock(m_latency_mutex);
+    for (latency_info_pair& latency : m_latencies) {
+        latency.second->reset();
+    }
+}
+
 std::ostream& operator<<(std::ostream& out, const timing_info& info) {
 
     for (std::size_t i = 0; i < info.data.size(); ++i) {
@@ -44,4 +89,78 @@ std::ostream& operator<<(std::ostream& out, const timing_info& info) {
     return out;
 }
 
+namespace {
+
+/// The percentiles reported for the latency histograms
+constexpr std::array<double, 3> latency_percentiles = {50., 90., 99.};
+
+/// Convert a time into (floating point) milliseconds
+double to_ms(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+}  // namespace
+
+void print_latencies(std::ostream& out, const timing_info& info) {
+
+    // Remember the formatting of the stream.
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    const std::vector<latency_info_pair>& latencies = info.latencies();
+    for (std::size_t i = 0; i < latencies.size(); ++i) {
+        const latency_histogram& histogram = *(latencies[i].second);
+        out << std::setw(30) << std::right << latencies[i].first << "  "
+            << std::fixed << std::setprecision(3);
+        for (double p : latency_percentiles) {
+            out << "p" << static_cast<int>(p) << ": "
+                << to_ms(histogram.percentile(p)) << " ms, ";
+        }
+        out << "max: " << to_ms(histogram.max()) << " ms";
+        if ((i + 1) < latencies.size()) {
+            out << "\n";
+        }
+    }
+
+    // Restore the formatting of the stream.
+    out.flags(flags);
+    out.precision(precision);
+}
+
+void write_latencies_json(std::ostream& out, const timing_info& info) {
+
+    const std::vector<latency_info_pair>& latencies = info.latencies();
+    out << "{\n";
+    for (std::size_t i = 0; i < latencies.size(); ++i) {
+        const latency_histogram& histogram = *(latencies[i].second);
+        out << "  \"" << latencies[i].first << "\": {\"count\": "
+            << histogram.count()
+            << ", \"mean_ns\": " << histogram.mean().count();
+        for (double p : latency_percentiles) {
+            out << ", \"p" << static_cast<int>(p)
+                << "_ns\": " << histogram.percentile(p).count();
+        }
+        out << ", \"max_ns\": " << histogram.max().count() << "}";
+        if ((i + 1) < latencies.size()) {
+            out << ",";
+        }
+        out << "\n";
+    }
+    out << "}" << std::endl;
+}
+
+void write_latencies_csv(std::ostream& out, const timing_info& info,
+                         std::string_view prefix) {
+
+    for (const latency_info_pair& latency : info.latencies()) {
+        const latency_histogram& histogram = *(latency.second);
+        out << prefix << "\"" << latency.first << "\"," << histogram.count()
+            << "," << histogram.mean().count();
+        for (double p : latency_percentiles) {
+            out << "," << histogram.percentile(p).count();
+        }
+        out << "," << histogram.max().count() << std::endl;
+    }
+}
+
 }  // namespace traccc::performance
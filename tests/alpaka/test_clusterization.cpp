@@ -0,0 +1,236 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/alpaka/clusterization/clusterization_algorithm.hpp"
+#include "traccc/alpaka/clusterization/spacepoint_formation_algorithm.hpp"
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/spacepoint_formation_algorithm.hpp"
+#include "traccc/definitions/common.hpp"
+
+// VecMem include(s).
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+#include <vecmem/utils/cuda/copy.hpp>
+#elif defined(ALPAKA_ACC_GPU_HIP_ENABLED)
+#include <vecmem/memory/hip/device_memory_resource.hpp>
+#include <vecmem/memory/hip/managed_memory_resource.hpp>
+#include <vecmem/utils/hip/copy.hpp>
+#endif
+
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+
+using namespace traccc;
+
+namespace {
+
+/// Memory resources and copy object for the tests, set up for the backend
+/// that alpaka was configured for
+struct alpaka_memory {
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+    vecmem::cuda::copy copy;
+    vecmem::cuda::device_memory_resource device_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+#elif defined(ALPAKA_ACC_GPU_HIP_ENABLED)
+    vecmem::hip::copy copy;
+    vecmem::hip::device_memory_resource device_mr;
+    vecmem::hip::managed_memory_resource mng_mr;
+#else
+    vecmem::copy copy;
+    vecmem::host_memory_resource device_mr;
+    vecmem::host_memory_resource mng_mr;
+#endif
+    vecmem::host_memory_resource host_mr;
+};
+
+}  // namespace
+
+TEST(AlpakaClustering, SingleModule) {
+
+    alpaka_memory mem;
+    traccc::memory_resource mr{mem.device_mr, &(mem.host_mr)};
+
+    // Create cell collection
+    traccc::cell_collection_types::host cells{&(mem.mng_mr)};
+
+    cells.push_back({1u, 2u, 1.f, 0, 0});
+    cells.push_back({2u, 2u, 1.f, 0, 0});
+    cells.push_back({3u, 2u, 1.f, 0, 0});
+
+    cells.push_back({6u, 4u, 1.f, 0, 0});
+    cells.push_back({5u, 5u, 1.f, 0, 0});
+    cells.push_back({6u, 5u, 1.f, 0, 0});
+    cells.push_back({7u, 5u, 1.f, 0, 0});
+    cells.push_back({6u, 6u, 1.f, 0, 0});
+
+    // Create module collection
+    traccc::cell_module_collection_types::host modules{&(mem.mng_mr)};
+    modules.push_back({});
+
+    // Run Clusterization
+    traccc::alpaka::clusterization_algorithm ca_alpaka(mr, mem.copy, 1024);
+
+    auto measurements_buffer =
+        ca_alpaka(vecmem::get_data(cells), vecmem::get_data(modules));
+
+    measurement_collection_types::host measurements{&(mem.host_mr)};
+    mem.copy(measurements_buffer, measurements)->wait();
+
+    // Run the host clusterization on the same input.
+    traccc::host::clusterization_algorithm ca_host(mem.host_mr);
+    auto ref_measurements =
+        ca_host(vecmem::get_data(cells), vecmem::get_data(modules));
+
+    // Check the results
+    ASSERT_EQ(measurements.size(), 2u);
+    std::set<measurement> test(measurements.begin(), measurements.end());
+    std::set<measurement> ref(ref_measurements.begin(),
+                              ref_measurements.end());
+    EXPECT_EQ(test, ref);
+}
+
+TEST(AlpakaClustering, ManyPartitions) {
+
+    alpaka_memory mem;
+    traccc::memory_resource mr{mem.device_mr, &(mem.host_mr)};
+
+    // Create a number of modules, with a few small clusters on each of them.
+    // Enough cells for the clusterization to use multiple partitions.
+    static constexpr unsigned int n_modules = 50u;
+    static constexpr unsigned int n_clusters = 6u;
+    traccc::cell_collection_types::host cells{&(mem.mng_mr)};
+    traccc::cell_module_collection_types::host modules{&(mem.mng_mr)};
+    for (unsigned int m = 0u; m < n_modules; ++m) {
+        traccc::cell_module module;
+        module.surface_link = detray::geometry::barcode{m};
+        modules.push_back(module);
+        for (unsigned int c = 0u; c < n_clusters; ++c) {
+            const channel_id channel0 = (3u * c + m) % 20u;
+            const channel_id channel1 = 4u * c;
+            cells.push_back({channel0, channel1, 1.f, 0, m});
+            cells.push_back({channel0 + 1u, channel1, 0.5f, 0, m});
+            cells.push_back({channel0, channel1 + 1u, 2.f, 0, m});
+        }
+    }
+
+    // Run the clusterization and spacepoint formation with alpaka.
+    traccc::alpaka::clusterization_algorithm ca_alpaka(mr, mem.copy, 64);
+    traccc::alpaka::spacepoint_formation_algorithm sf_alpaka(mr, mem.copy);
+
+    auto measurements_buffer =
+        ca_alpaka(vecmem::get_data(cells), vecmem::get_data(modules));
+    auto spacepoints_buffer =
+        sf_alpaka(measurements_buffer, vecmem::get_data(modules));
+
+    measurement_collection_types::host measurements{&(mem.host_mr)};
+    mem.copy(measurements_buffer, measurements)->wait();
+    spacepoint_collection_types::host spacepoints{&(mem.host_mr)};
+    mem.copy(spacepoints_buffer, spacepoints)->wait();
+
+    // Run the same algorithms on the host.
+    traccc::host::clusterization_algorithm ca_host(mem.host_mr);
+    traccc::host::spacepoint_formation_algorithm sf_host(mem.host_mr);
+    auto ref_measurements =
+        ca_host(vecmem::get_data(cells), vecmem::get_data(modules));
+    auto ref_spacepoints = sf_host(vecmem::get_data(ref_measurements),
+                                   vecmem::get_data(modules));
+
+    // Compare the results.
+    ASSERT_EQ(measurements.size(), n_modules * n_clusters);
+    ASSERT_EQ(measurements.size(), ref_measurements.size());
+    std::set<measurement> test(measurements.begin(), measurements.end());
+    std::set<measurement> ref(ref_measurements.begin(),
+                              ref_measurements.end());
+    EXPECT_EQ(test, ref);
+
+    ASSERT_EQ(spacepoints.size(), ref_spacepoints.size());
+    std::set<measurement> test_sp, ref_sp;
+    for (std::size_t i = 0; i < spacepoints.size(); ++i) {
+        test_sp.insert(spacepoints[i].meas);
+        ref_sp.insert(ref_spacepoints[i].meas);
+        EXPECT_NEAR(spacepoints[i].x(), spacepoints[i].meas.local[0],
+                    float_epsilon);
+        EXPECT_NEAR(spacepoints[i].y(), spacepoints[i].meas.local[1],
+                    float_epsilon);
+    }
+    EXPECT_EQ(test_sp, ref_sp);
+}
+
+TEST(AlpakaClustering, LargeClusters) {
+
+    alpaka_memory mem;
+    traccc::memory_resource mr{mem.device_mr, &(mem.host_mr)};
+
+    // Create a few modules, each with a line-like cluster of more than 32
+    // cells, and a small cluster next to it.
+    static constexpr unsigned int n_modules = 4u;
+    traccc::cell_collection_types::host cells{&(mem.mng_mr)};
+    traccc::cell_module_collection_types::host modules{&(mem.mng_mr)};
+    for (unsigned int m = 0u; m < n_modules; ++m) {
+        traccc::cell_module module;
+        module.surface_link = detray::geometry::barcode{m};
+        modules.push_back(module);
+        const unsigned int line_length = 40u + 10u * m;
+        for (unsigned int c = 0u; c < line_length; ++c) {
+            const scalar activation = 1.f + 0.1f * static_cast<scalar>(c);
+            cells.push_back({5u + (c % 2u), c, activation, 0, m});
+        }
+        cells.push_back({10u, line_length + 10u, 1.f, 0, m});
+        cells.push_back({11u, line_length + 10u, 2.f, 0, m});
+    }
+
+    // Run the clusterization with alpaka and on the host.
+    traccc::alpaka::clusterization_algorithm ca_alpaka(mr, mem.copy, 64);
+    auto measurements_buffer =
+        ca_alpaka(vecmem::get_data(cells), vecmem::get_data(modules));
+    measurement_collection_types::host measurements{&(mem.host_mr)};
+    mem.copy(measurements_buffer, measurements)->wait();
+
+    traccc::host::clusterization_algorithm ca_host(mem.host_mr);
+    auto ref_measurements =
+        ca_host(vecmem::get_data(cells), vecmem::get_data(modules));
+
+    // Compare the results.
+    ASSERT_EQ(measurements.size(), 2u * n_modules);
+    std::set<measurement> test(measurements.begin(), measurements.end());
+    std::set<measurement> ref(ref_measurements.begin(),
+                              ref_measurements.end());
+    EXPECT_EQ(test, ref);
+}
+
+TEST(AlpakaClustering, OversizedPartition) {
+
+    alpaka_memory mem;
+    traccc::memory_resource mr{mem.device_mr, &(mem.host_mr)};
+
+    // Create a single module, with one chain of neighbouring cells that is
+    // too long for any block to process.
+    static constexpr unsigned int n_cells = 2000u;
+    traccc::cell_collection_types::host cells{&(mem.mng_mr)};
+    traccc::cell_module_collection_types::host modules{&(mem.mng_mr)};
+    modules.push_back({});
+    for (unsigned int c = 0u; c < n_cells; ++c) {
+        cells.push_back({5u, c, 1.f, 0, 0});
+    }
+
+    // The clusterization must report the problem, instead of producing
+    // wrong results.
+    traccc::alpaka::clusterization_algorithm ca_alpaka(mr, mem.copy, 64);
+    EXPECT_THROW(
+        ca_alpaka(vecmem::get_data(cells), vecmem::get_data(modules)),
+        std::runtime_error);
+}
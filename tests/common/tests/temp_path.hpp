@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace traccc::tests {
+
+/// Get a unique path in the temporary directory, for the current test
+///
+/// The path contains the name of the running test and a random suffix, so
+/// that tests running in parallel (also from different build directories)
+/// would not use the same files.
+///
+/// @param name The base name of the file (or directory)
+/// @param extension The extension of the file, including the leading dot
+/// @return A path that is unique to this call of the current test
+///
+inline std::filesystem::path unique_temp_path(
+    const std::string& name, const std::string& extension = "") {
+
+    std::ostringstream filename;
+    filename << name;
+    const ::testing::TestInfo* test_info =
+        ::testing::UnitTest::GetInstance()->current_test_info();
+    if (test_info != nullptr) {
+        filename << "_" << test_info->test_suite_name() << "_"
+                 << test_info->name();
+    }
+    std::random_device random;
+    filename << "_" << std::hex << random() << random() << extension;
+    return std::filesystem::temp_directory_path() / filename.str();
+}
+
+}  // namespace traccc::tests
@@ -100,8 +100,9 @@ TEST_P(CompareWithActsSeedingTests, Run) {
       TRACCC seeding
       --------------------------------*/
 
-    auto internal_spacepoints_per_event = sb(spacepoints_per_event);
-    auto seeds = sf(spacepoints_per_event, internal_spacepoints_per_event);
+    auto grids = sb.make_grids(spacepoints_per_event);
+    auto& internal_spacepoints_per_event = grids.grid;
+    auto seeds = sf(spacepoints_per_event, grids.grid, grids.soa_grid);
 
     /*--------------------------------
       ACTS seeding
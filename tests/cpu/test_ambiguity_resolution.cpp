@@ -0,0 +1,222 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Add a track, made out of the given measurements, to a track container
+void add_track(traccc::track_state_container_types::host& tracks,
+               const std::vector<std::size_t>& measurement_ids,
+               traccc::scalar chi2) {
+
+    traccc::fitting_result<traccc::default_algebra> header;
+    header.chi2 = chi2;
+    vecmem::vector<traccc::track_state<traccc::default_algebra>> states;
+    for (std::size_t id : measurement_ids) {
+        traccc::track_candidate cand;
+        cand.measurement_id = id;
+        states.emplace_back(cand);
+    }
+    tracks.push_back(header, states);
+}
+
+/// Configuration silencing the algorithm
+traccc::greedy_ambiguity_resolution_algorithm::config_t make_config() {
+
+    traccc::greedy_ambiguity_resolution_algorithm::config_t cfg;
+    cfg.check_obvious_errs = false;
+    cfg.verbose_error = false;
+    cfg.verbose_warning = false;
+    return cfg;
+}
+
+}  // namespace
+
+TEST(greedy_ambiguity_resolution, eviction_order) {
+
+    traccc::track_state_container_types::host tracks;
+    // Tracks 0 and 1 have the same amount of relative shared measurements,
+    // the one with the larger chi2 is removed.
+    add_track(tracks, {1u, 2u, 3u, 4u}, 1.f);
+    add_track(tracks, {1u, 2u, 3u, 5u}, 2.f);
+    // Independent track.
+    add_track(tracks, {6u, 7u, 8u}, 5.f);
+    // After the removal of track 1, this track shares relatively more
+    // measurements with track 0 than track 0 with it.
+    add_track(tracks, {4u, 9u, 10u}, 0.5f);
+
+    const traccc::greedy_ambiguity_resolution_algorithm resolution(
+        make_config());
+    const traccc::track_state_container_types::host result =
+        resolution(tracks);
+
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result.at(0).header.chi2, 1.f);
+    EXPECT_EQ(result.at(1).header.chi2, 5.f);
+}
+
+TEST(greedy_ambiguity_resolution, independent_tracks) {
+
+    std::mt19937 gen(42u);
+    std::uniform_int_distribution<std::size_t> meas_dist(1u, 400u);
+    std::uniform_int_distribution<std::size_t> size_dist(3u, 10u);
+    std::uniform_real_distribution<traccc::scalar> chi2_dist(0.f, 10.f);
+
+    traccc::track_state_container_types::host tracks;
+    for (unsigned int i = 0; i < 200u; ++i) {
+        std::vector<std::size_t> measurement_ids(size_dist(gen));
+        for (std::size_t& id : measurement_ids) {
+            id = meas_dist(gen);
+        }
+        add_track(tracks, measurement_ids, chi2_dist(gen));
+    }
+
+    const traccc::greedy_ambiguity_resolution_algorithm resolution(
+        make_config());
+    const traccc::track_state_container_types::host result =
+        resolution(tracks);
+    ASSERT_GT(result.size(), 0u);
+
+    // No measurement may be shared by the selected tracks.
+    std::map<std::size_t, std::size_t> n_tracks_per_measurement;
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        std::map<std::size_t, bool> seen;
+        for (const auto& st : result.at(i).items) {
+            const std::size_t id = st.get_measurement().measurement_id;
+            if (!seen[id]) {
+                seen[id] = true;
+                ++n_tracks_per_measurement[id];
+            }
+        }
+    }
+    for (const auto& [id, n_tracks] : n_tracks_per_measurement) {
+        EXPECT_EQ(n_tracks, 1u) << "measurement " << id;
+    }
+}
+
+TEST(greedy_ambiguity_resolution, parallel) {
+
+    std::mt19937 gen(1234u);
+    std::uniform_int_distribution<std::size_t> meas_dist(1u, 2000u);
+    std::uniform_int_distribution<std::size_t> size_dist(3u, 10u);
+    std::uniform_real_distribution<traccc::scalar> chi2_dist(0.f, 10.f);
+
+    traccc::track_state_container_types::host tracks;
+    for (unsigned int i = 0; i < 500u; ++i) {
+        std::vector<std::size_t> measurement_ids(size_dist(gen));
+        for (std::size_t& id : measurement_ids) {
+            id = meas_dist(gen);
+        }
+        add_track(tracks, measurement_ids, chi2_dist(gen));
+    }
+
+    const traccc::track_state_container_types::host result =
+        traccc::greedy_ambiguity_resolution_algorithm{make_config()}(tracks);
+    const traccc::track_state_container_types::host result_parallel =
+        traccc::greedy_ambiguity_resolution_algorithm{make_config(),
+                                                      true}(tracks);
+
+    // The parallel mode must select the same tracks, in the same order.
+    ASSERT_EQ(result.size(), result_parallel.size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result.at(i).header.chi2, result_parallel.at(i).header.chi2);
+        ASSERT_EQ(result.at(i).items.size(),
+                  result_parallel.at(i).items.size());
+        for (std::size_t j = 0; j < result.at(i).items.size(); ++j) {
+            EXPECT_EQ(
+                result.at(i).items[j].get_measurement().measurement_id,
+                result_parallel.at(i).items[j].get_measurement().measurement_id);
+        }
+    }
+}
+
+TEST(greedy_ambiguity_resolution, compact_candidates) {
+
+    std::mt19937 gen(5678u);
+    std::uniform_int_distribution<std::size_t> meas_dist(0u, 399u);
+    std::uniform_int_distribution<std::size_t> size_dist(3u, 10u);
+    std::uniform_real_distribution<traccc::scalar> chi2_dist(0.f, 10.f);
+
+    // The measurements of the event, with unique identifiers.
+    traccc::measurement_collection_types::host measurements;
+    for (std::size_t i = 0; i < 400u; ++i) {
+        traccc::measurement meas;
+        meas.measurement_id = i + 1u;
+        measurements.push_back(meas);
+    }
+
+    // The same tracks, as full track states and as compact candidates.
+    traccc::track_state_container_types::host tracks;
+    traccc::compact_track_candidate_container_types::host candidates;
+    for (unsigned int i = 0; i < 200u; ++i) {
+        std::vector<std::size_t> measurement_ids(size_dist(gen));
+        vecmem::vector<traccc::compact_track_candidate> cands;
+        for (std::size_t& id : measurement_ids) {
+            const std::size_t index = meas_dist(gen);
+            id = measurements[index].measurement_id;
+            cands.push_back(
+                {static_cast<traccc::compact_track_candidate::link_type>(
+                    index)});
+        }
+        add_track(tracks, measurement_ids, chi2_dist(gen));
+        candidates.push_back(traccc::bound_track_parameters{}, cands);
+    }
+
+    const traccc::greedy_ambiguity_resolution_algorithm resolution(
+        make_config());
+    const traccc::track_state_container_types::host result =
+        resolution(tracks);
+    const traccc::compact_track_candidate_container_types::host
+        compact_result =
+            resolution(tracks.get_headers(), candidates, measurements);
+
+    // The same tracks must be selected, in the same order.
+    ASSERT_EQ(result.size(), compact_result.size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        ASSERT_EQ(result.at(i).items.size(),
+                  compact_result.at(i).items.size());
+        for (std::size_t j = 0; j < result.at(i).items.size(); ++j) {
+            EXPECT_EQ(result.at(i).items[j].get_measurement().measurement_id,
+                      compact_result.at(i)
+                          .items[j]
+                          .get_measurement(measurements)
+                          .measurement_id);
+        }
+    }
+
+    // The full candidates created from the compact ones must refer to the
+    // same measurements.
+    const traccc::track_candidate_container_types::host full_candidates =
+        traccc::make_track_candidates(candidates, measurements);
+    ASSERT_EQ(full_candidates.size(), candidates.size());
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        ASSERT_EQ(full_candidates.at(i).items.size(),
+                  candidates.at(i).items.size());
+        for (std::size_t j = 0; j < candidates.at(i).items.size(); ++j) {
+            EXPECT_EQ(full_candidates.at(i).items[j].measurement_id,
+                      candidates.at(i)
+                          .items[j]
+                          .get_measurement(measurements)
+                          .measurement_id);
+        }
+    }
+}
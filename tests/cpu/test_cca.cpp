@@ -26,20 +26,31 @@
 namespace {
 vecmem::host_memory_resource resource;
 traccc::host::clusterization_algorithm ca(resource);
+traccc::host::clusterization_algorithm ca_parallel(resource, true);
 
-cca_function_t f = [](const traccc::cell_collection_types::host& cells,
-                      const traccc::cell_module_collection_types::host&
-                          modules) {
-    std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>> result;
+cca_function_t make_cca_function(
+    const traccc::host::clusterization_algorithm& algorithm) {
 
-    auto measurements = ca(vecmem::get_data(cells), vecmem::get_data(modules));
-    for (std::size_t i = 0; i < measurements.size(); i++) {
-        result[modules.at(measurements.at(i).module_link).surface_link.value()]
-            .push_back(measurements.at(i));
-    }
+    return [&algorithm](const traccc::cell_collection_types::host& cells,
+                        const traccc::cell_module_collection_types::host&
+                            modules) {
+        std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>>
+            result;
 
-    return result;
-};
+        auto measurements =
+            algorithm(vecmem::get_data(cells), vecmem::get_data(modules));
+        for (std::size_t i = 0; i < measurements.size(); i++) {
+            result[modules.at(measurements.at(i).module_link)
+                       .surface_link.value()]
+                .push_back(measurements.at(i));
+        }
+
+        return result;
+    };
+}
+
+cca_function_t f = make_cca_function(ca);
+cca_function_t f_parallel = make_cca_function(ca_parallel);
 }  // namespace
 
 TEST_P(ConnectedComponentAnalysisTests, Run) {
@@ -52,3 +63,10 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values(f),
         ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
     ConnectedComponentAnalysisTests::get_test_name);
+
+INSTANTIATE_TEST_SUITE_P(
+    ParallelSparseCclAlgorithm, ConnectedComponentAnalysisTests,
+    ::testing::Combine(
+        ::testing::Values(f_parallel),
+        ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
+    ConnectedComponentAnalysisTests::get_test_name);
@@ -125,6 +125,8 @@ TEST_P(CpuCkfCombinatoricsTelescopeTests, Run) {
         host_finding(cfg_no_limit);
     traccc::finding_algorithm<rk_stepper_type, host_navigator_type>
         host_finding_limit(cfg_limit);
+    traccc::finding_algorithm<rk_stepper_type, host_navigator_type>
+        host_finding_limit_parallel(cfg_limit, true);
 
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
@@ -164,6 +166,22 @@ TEST_P(CpuCkfCombinatoricsTelescopeTests, Run) {
                   std::pow(n_truth_tracks, plane_positions.size() + 1));
         ASSERT_EQ(track_candidates_limit.size(),
                   n_truth_tracks * cfg_limit.max_num_branches_per_seed);
+
+        // The parallel track finding must find the same candidates, in the
+        // same order
+        auto track_candidates_limit_parallel = host_finding_limit_parallel(
+            host_det, field, measurements_per_event, seeds);
+        ASSERT_EQ(track_candidates_limit_parallel.size(),
+                  track_candidates_limit.size());
+        for (std::size_t i = 0; i < track_candidates_limit.size(); ++i) {
+            const auto& items = track_candidates_limit.get_items()[i];
+            const auto& items_parallel =
+                track_candidates_limit_parallel.get_items()[i];
+            ASSERT_EQ(items.size(), items_parallel.size());
+            for (std::size_t j = 0; j < items.size(); ++j) {
+                EXPECT_EQ(items[j], items_parallel[j]);
+            }
+        }
     }
 }
 
@@ -0,0 +1,195 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+
+// Detray include(s).
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cmath>
+#include <random>
+
+namespace {
+
+using algebra_type = traccc::default_algebra;
+using updater_type = traccc::gain_matrix_updater<algebra_type>;
+
+/// Generate random predicted track parameters, with a valid covariance
+traccc::bound_track_parameters make_parameters(std::mt19937& gen) {
+
+    std::normal_distribution<traccc::scalar> dist(0.f, 1.f);
+
+    traccc::bound_track_parameters params;
+    traccc::bound_vector vec = params.vector();
+    for (unsigned int i = 0u; i < traccc::e_bound_size; ++i) {
+        traccc::getter::element(vec, i, 0u) = dist(gen);
+    }
+
+    // A covariance of the form A * A^T + epsilon * I.
+    traccc::bound_covariance a = params.covariance();
+    for (unsigned int i = 0u; i < traccc::e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < traccc::e_bound_size; ++j) {
+            traccc::getter::element(a, i, j) = dist(gen);
+        }
+    }
+    traccc::bound_covariance cov = a;
+    for (unsigned int i = 0u; i < traccc::e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < traccc::e_bound_size; ++j) {
+            traccc::scalar value = (i == j) ? 0.1f : 0.f;
+            for (unsigned int k = 0u; k < traccc::e_bound_size; ++k) {
+                value += traccc::getter::element(a, i, k) *
+                         traccc::getter::element(a, j, k);
+            }
+            traccc::getter::element(cov, i, j) = value;
+        }
+    }
+
+    params.set_vector(vec);
+    params.set_covariance(cov);
+    return params;
+}
+
+/// Compare two scalars with a relative tolerance
+void expect_close(traccc::scalar a, traccc::scalar b) {
+    EXPECT_NEAR(a, b, 1e-3f * (1.f + std::abs(a)));
+}
+
+/// Run the generic and projected updates, and compare their results
+template <unsigned int D, typename shape_t>
+void compare_updates(unsigned int axis0, unsigned int seed) {
+
+    std::mt19937 gen(seed);
+    std::normal_distribution<traccc::scalar> dist(0.f, 1.f);
+    std::uniform_real_distribution<traccc::scalar> var_dist(0.1f, 1.f);
+
+    for (unsigned int iter = 0u; iter < 100u; ++iter) {
+
+        traccc::measurement meas;
+        meas.local = {dist(gen), dist(gen)};
+        meas.variance = {var_dist(gen), var_dist(gen)};
+        meas.meas_dim = D;
+        meas.subs.set_indices({axis0, (axis0 == 0u) ? 1u : 0u});
+
+        traccc::track_state<algebra_type> state_generic(meas);
+        traccc::track_state<algebra_type> state_projected(meas);
+        traccc::bound_track_parameters params_generic = make_parameters(gen);
+        traccc::bound_track_parameters params_projected = params_generic;
+
+        updater_type{}.template update_generic<D, shape_t>(state_generic,
+                                                           params_generic);
+        updater_type{}.template update_projected<D, shape_t>(
+            state_projected, params_projected);
+
+        const traccc::bound_vector& vec_generic = params_generic.vector();
+        const traccc::bound_vector& vec_projected = params_projected.vector();
+        const traccc::bound_covariance& cov_generic =
+            params_generic.covariance();
+        const traccc::bound_covariance& cov_projected =
+            params_projected.covariance();
+        for (unsigned int i = 0u; i < traccc::e_bound_size; ++i) {
+            expect_close(traccc::getter::element(vec_generic, i, 0u),
+                         traccc::getter::element(vec_projected, i, 0u));
+            for (unsigned int j = 0u; j < traccc::e_bound_size; ++j) {
+                expect_close(traccc::getter::element(cov_generic, i, j),
+                             traccc::getter::element(cov_projected, i, j));
+            }
+        }
+        expect_close(state_generic.filtered_chi2(),
+                     state_projected.filtered_chi2());
+    }
+}
+
+/// Check the gated update against the predicted and filtered chi-squares
+template <unsigned int D, typename shape_t>
+void check_gated_update(unsigned int axis0, unsigned int seed) {
+
+    std::mt19937 gen(seed);
+    std::normal_distribution<traccc::scalar> dist(0.f, 1.f);
+    std::uniform_real_distribution<traccc::scalar> var_dist(0.1f, 1.f);
+
+    for (unsigned int iter = 0u; iter < 100u; ++iter) {
+
+        traccc::measurement meas;
+        meas.local = {dist(gen), dist(gen)};
+        meas.variance = {var_dist(gen), var_dist(gen)};
+        meas.meas_dim = D;
+        meas.subs.set_indices({axis0, (axis0 == 0u) ? 1u : 0u});
+
+        const traccc::bound_track_parameters predicted = make_parameters(gen);
+
+        traccc::track_state<algebra_type> state(meas);
+        traccc::bound_track_parameters params = predicted;
+        updater_type{}.template update<D, shape_t>(state, params);
+
+        // The predicted chi-square should agree with the filtered one.
+        const traccc::scalar chi2 =
+            updater_type{}.template predicted_chi2<D, shape_t>(state,
+                                                              predicted);
+        expect_close(chi2, state.filtered_chi2());
+
+        // Measurements above the cut should leave the parameters untouched.
+        traccc::track_state<algebra_type> rejected_state(meas);
+        traccc::bound_track_parameters rejected_params = predicted;
+        updater_type{}.template gated_update<D, shape_t>(
+            rejected_state, rejected_params, 0.5f * chi2);
+        expect_close(rejected_state.filtered_chi2(), chi2);
+        for (unsigned int i = 0u; i < traccc::e_bound_size; ++i) {
+            EXPECT_EQ(traccc::getter::element(rejected_params.vector(), i, 0u),
+                      traccc::getter::element(predicted.vector(), i, 0u));
+        }
+
+        // Measurements below the cut should get the full update.
+        traccc::track_state<algebra_type> accepted_state(meas);
+        traccc::bound_track_parameters accepted_params = predicted;
+        updater_type{}.template gated_update<D, shape_t>(
+            accepted_state, accepted_params, 2.f * chi2 + 1.f);
+        for (unsigned int i = 0u; i < traccc::e_bound_size; ++i) {
+            EXPECT_EQ(traccc::getter::element(accepted_params.vector(), i, 0u),
+                      traccc::getter::element(params.vector(), i, 0u));
+        }
+        EXPECT_EQ(accepted_state.filtered_chi2(), state.filtered_chi2());
+    }
+}
+
+}  // namespace
+
+TEST(gain_matrix_updater, projected_2D) {
+
+    compare_updates<2u, detray::rectangle2D>(0u, 1u);
+}
+
+TEST(gain_matrix_updater, projected_1D) {
+
+    compare_updates<1u, detray::rectangle2D>(0u, 2u);
+    compare_updates<1u, detray::rectangle2D>(1u, 3u);
+}
+
+TEST(gain_matrix_updater, projected_line) {
+
+    compare_updates<2u, detray::line<true>>(0u, 4u);
+    compare_updates<1u, detray::line<false>>(0u, 5u);
+    compare_updates<1u, detray::line<false>>(1u, 6u);
+}
+
+TEST(gain_matrix_updater, gated_update) {
+
+    check_gated_update<2u, detray::rectangle2D>(0u, 7u);
+    check_gated_update<1u, detray::rectangle2D>(1u, 8u);
+    check_gated_update<2u, detray::line<true>>(0u, 9u);
+    check_gated_update<1u, detray::line<false>>(1u, 10u);
+}
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -115,6 +115,7 @@ TEST_P(KalmanFittingTelescopeTests, Run) {
     // Fitting algorithm object
     typename traccc::fitting_algorithm<host_fitter_type>::config_type fit_cfg;
     fitting_algorithm<host_fitter_type> fitting(fit_cfg);
+    fitting_algorithm<host_fitter_type> parallel_fitting(fit_cfg, true);
 
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
@@ -137,6 +138,64 @@ TEST_P(KalmanFittingTelescopeTests, Run) {
         // n_trakcs = 100
         ASSERT_EQ(n_tracks, n_truth_tracks);
 
+        // The parallel fitting must give the same results, in the same order
+        auto parallel_track_states =
+            parallel_fitting(host_det, field, track_candidates);
+        ASSERT_EQ(parallel_track_states.size(), n_tracks);
+        for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+            const auto& fit_res = track_states[i_trk].header;
+            const auto& parallel_fit_res = parallel_track_states[i_trk].header;
+            EXPECT_EQ(fit_res.ndf, parallel_fit_res.ndf);
+            EXPECT_EQ(fit_res.chi2, parallel_fit_res.chi2);
+            EXPECT_EQ(fit_res.fit_params.vector(),
+                      parallel_fit_res.fit_params.vector());
+            EXPECT_EQ(track_states[i_trk].items.size(),
+                      parallel_track_states[i_trk].items.size());
+        }
+
+        // The compact fitting must give the same smoothed track states
+        traccc::measurement_collection_types::host measurements{&host_mr};
+        traccc::compact_track_candidate_container_types::host
+            compact_candidates;
+        for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+            vecmem::vector<traccc::compact_track_candidate> cands;
+            for (const auto& cand : track_candidates[i_trk].items) {
+                cands.push_back(
+                    {static_cast<traccc::compact_track_candidate::link_type>(
+                        measurements.size())});
+                measurements.push_back(cand);
+            }
+            compact_candidates.push_back(track_candidates[i_trk].header,
+                                         std::move(cands));
+        }
+        for (const auto* alg : {&fitting, &parallel_fitting}) {
+            auto compact_track_states = alg->fit_compact(
+                host_det, field, compact_candidates, measurements);
+            ASSERT_EQ(compact_track_states.size(), n_tracks);
+            for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
+                const auto& fit_res = track_states[i_trk].header;
+                const auto& compact_fit_res =
+                    compact_track_states[i_trk].header;
+                EXPECT_EQ(fit_res.ndf, compact_fit_res.ndf);
+                EXPECT_EQ(fit_res.chi2, compact_fit_res.chi2);
+
+                const auto& states = track_states[i_trk].items;
+                const auto& compact_states = compact_track_states[i_trk].items;
+                ASSERT_EQ(states.size(), compact_states.size());
+                for (std::size_t i_st = 0; i_st < states.size(); i_st++) {
+                    EXPECT_EQ(states[i_st].smoothed().vector(),
+                              compact_states[i_st].smoothed.vector());
+                    EXPECT_EQ(states[i_st].smoothed_chi2(),
+                              compact_states[i_st].smoothed_chi2);
+                    EXPECT_EQ(states[i_st].is_hole,
+                              compact_states[i_st].is_hole);
+                    EXPECT_EQ(states[i_st].get_measurement(),
+                              compact_states[i_st].get_measurement(
+                                  measurements));
+                }
+            }
+        }
+
         for (std::size_t i_trk = 0; i_trk < n_tracks; i_trk++) {
 
             const auto& track_states_per_track = track_states[i_trk].items;
@@ -0,0 +1,89 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/performance/latency_histogram.hpp"
+#include "traccc/performance/timing_info.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+using traccc::performance::latency_histogram;
+
+// Test that every value is stored in a bucket covering it
+TEST(latency_histogram, buckets) {
+
+    for (std::size_t i = 1; i < latency_histogram::n_buckets; ++i) {
+        const std::uint64_t last = latency_histogram::bucket_max_value(i - 1);
+        ASSERT_EQ(latency_histogram::bucket_index(last), i - 1);
+        ASSERT_EQ(latency_histogram::bucket_index(last + 1), i);
+    }
+    EXPECT_EQ(latency_histogram::bucket_index(~std::uint64_t{0}),
+              latency_histogram::n_buckets - 1);
+}
+
+// Test the percentiles against the exact values of a random sample
+TEST(latency_histogram, percentiles) {
+
+    std::mt19937 gen(42);
+    std::lognormal_distribution<double> dist(13., 1.);
+
+    latency_histogram histogram;
+    std::vector<std::int64_t> values;
+    for (std::size_t i = 0; i < 100000; ++i) {
+        values.push_back(static_cast<std::int64_t>(dist(gen)));
+        histogram.record(std::chrono::nanoseconds{values.back()});
+    }
+    std::sort(values.begin(), values.end());
+
+    ASSERT_EQ(histogram.count(), values.size());
+    EXPECT_EQ(histogram.max().count(), values.back());
+    for (double percent : {50., 90., 99.}) {
+        const auto exact = static_cast<double>(
+            values[static_cast<std::size_t>(percent * 0.01 * values.size()) -
+                   1]);
+        EXPECT_NEAR(static_cast<double>(histogram.percentile(percent).count()),
+                    exact, exact * 0.01);
+    }
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0u);
+    EXPECT_EQ(histogram.percentile(50.).count(), 0);
+}
+
+// Test recording latencies from multiple threads
+TEST(latency_histogram, timing_info_threads) {
+
+    traccc::performance::timing_info times;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&times, t]() {
+            for (int i = 1; i <= 1000; ++i) {
+                times.record_latency((t % 2) ? "Odd" : "Even",
+                                     std::chrono::nanoseconds{i});
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(times.latencies().size(), 2u);
+    EXPECT_EQ(times.get_latency("Odd").count(), 2000u);
+    EXPECT_EQ(times.get_latency("Even").count(), 2000u);
+    EXPECT_EQ(times.get_latency("Odd").max().count(), 1000);
+    EXPECT_ANY_THROW(times.get_latency("Unknown"));
+}
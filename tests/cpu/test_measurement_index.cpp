@@ -0,0 +1,89 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
+
+// Detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+/// Create the barcode of a surface
+detray::geometry::barcode make_barcode(unsigned int volume,
+                                       unsigned int index) {
+    detray::geometry::barcode bcd{};
+    bcd.set_volume(volume).set_index(index);
+    return bcd;
+}
+
+}  // namespace
+
+TEST(measurement_index, lookup) {
+
+    vecmem::host_memory_resource mr;
+
+    // Number of measurements on the surfaces of a few volumes.
+    struct surface {
+        unsigned int volume;
+        unsigned int index;
+        unsigned int n_measurements;
+    };
+    const std::vector<surface> surfaces = {
+        {1u, 0u, 2u}, {1u, 3u, 1u}, {1u, 4u, 0u},
+        {2u, 5u, 4u}, {2u, 9u, 1u}, {3u, 12u, 3u}};
+
+    traccc::measurement_collection_types::host measurements{&mr};
+    for (const surface& sf : surfaces) {
+        for (unsigned int i = 0; i < sf.n_measurements; ++i) {
+            traccc::measurement meas;
+            meas.surface_link = make_barcode(sf.volume, sf.index);
+            meas.local = {static_cast<traccc::scalar>(i), 0.f};
+            measurements.push_back(meas);
+        }
+    }
+    std::sort(measurements.begin(), measurements.end(),
+              traccc::measurement_sort_comp());
+
+    const traccc::measurement_index_collection_types::host index =
+        traccc::make_measurement_index(vecmem::get_data(measurements), mr,
+                                       20u);
+    ASSERT_EQ(index.size(), 20u);
+
+    // Every surface must find exactly its own measurements.
+    unsigned int n_found = 0u;
+    for (const surface& sf : surfaces) {
+        const detray::geometry::barcode bcd =
+            make_barcode(sf.volume, sf.index);
+        const traccc::measurement_range range =
+            traccc::get_measurement_range(index, bcd);
+        ASSERT_EQ(range.size(), sf.n_measurements);
+        for (unsigned int i = range.begin; i < range.end; ++i) {
+            EXPECT_EQ(measurements[i].surface_link, bcd);
+        }
+        n_found += range.size();
+    }
+    EXPECT_EQ(n_found, measurements.size());
+
+    // Surfaces without measurements, and ones outside of the index.
+    EXPECT_EQ(traccc::get_measurement_range(index, make_barcode(1u, 1u)).size(),
+              0u);
+    EXPECT_EQ(
+        traccc::get_measurement_range(index, make_barcode(3u, 100u)).size(),
+        0u);
+}
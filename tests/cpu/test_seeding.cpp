@@ -8,8 +8,14 @@
 // Project include(s).
 #include "traccc/definitions/common.hpp"
 #include "traccc/edm/spacepoint.hpp"
+#include "traccc/seeding/detail/spacepoint_soa_grid.hpp"
+#include "traccc/seeding/doublet_finding.hpp"
+#include "traccc/seeding/seed_finding.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/spacepoint_binning.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/seeding/triplet_finding.hpp"
+#include "traccc/seeding/triplet_finding_helper.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -17,6 +23,13 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
 using namespace traccc;
 
 namespace {
@@ -28,6 +41,31 @@ vecmem::host_memory_resource host_mr;
 static constexpr vector3 B{0. * unit<scalar>::T, 0. * unit<scalar>::T,
                            2. * unit<scalar>::T};
 
+// Spacepoints from straight tracks, spread over the whole grid
+spacepoint_collection_types::host make_straight_tracks(unsigned int n_tracks) {
+
+    spacepoint_collection_types::host spacepoints;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<scalar> phi_dist(-3.1f, 3.1f);
+    std::uniform_real_distribution<scalar> cot_dist(-2.f, 2.f);
+    for (unsigned int i = 0; i < n_tracks; ++i) {
+        const scalar phi = phi_dist(gen);
+        const scalar cot_theta = cot_dist(gen);
+        for (scalar r : {36.f, 94.f, 149.f, 218.f, 275.f}) {
+            spacepoints.push_back({{r * std::cos(phi), r * std::sin(phi),
+                                    r * cot_theta},
+                                   {}});
+        }
+    }
+    return spacepoints;
+}
+
+// Check that two values agree up to floating point rounding differences
+void expect_close(scalar a, scalar b) {
+    EXPECT_NEAR(a, b, 1e-5f * std::max(std::abs(a), std::abs(b)));
+}
+
 }  // namespace
 
 // Seeding with two muons
@@ -114,3 +152,318 @@ TEST(seeding, case2) {
                 0.1 * unit<scalar>::GeV);
     */
 }
+
+// Parallel seed finding with many straight tracks
+TEST(seeding, parallel) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+
+    const spacepoint_collection_types::host spacepoints =
+        make_straight_tracks(500u);
+
+    // Run the seed finding both sequentially and in parallel
+    const traccc::spacepoint_binning::grids_type grids =
+        traccc::spacepoint_binning(finder_config, grid_config, host_mr)
+            .make_grids(spacepoints);
+    const auto seeds = traccc::seed_finding(finder_config, filter_config)(
+        spacepoints, grids.grid, grids.soa_grid);
+    const auto seeds_parallel = traccc::seed_finding(
+        finder_config, filter_config, true)(spacepoints, grids.grid,
+                                            grids.soa_grid);
+
+    // The results must be identical
+    ASSERT_GT(seeds.size(), 0u);
+    ASSERT_EQ(seeds.size(), seeds_parallel.size());
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+        EXPECT_EQ(seeds[i].spB_link, seeds_parallel[i].spB_link);
+        EXPECT_EQ(seeds[i].spM_link, seeds_parallel[i].spM_link);
+        EXPECT_EQ(seeds[i].spT_link, seeds_parallel[i].spT_link);
+        EXPECT_EQ(seeds[i].weight, seeds_parallel[i].weight);
+        EXPECT_EQ(seeds[i].z_vertex, seeds_parallel[i].z_vertex);
+    }
+}
+
+// Doublet finding on the compact spacepoint grid
+TEST(seeding, soa_grid_doublets) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+
+    const spacepoint_collection_types::host spacepoints =
+        make_straight_tracks(500u);
+
+    // Create both versions of the grid
+    const traccc::sp_grid grid = traccc::spacepoint_binning(
+        finder_config, grid_config, host_mr)(spacepoints);
+    const traccc::sp_soa_grid soa_grid(grid, host_mr);
+    ASSERT_EQ(grid.nbins(), soa_grid.nbins());
+
+    traccc::doublet_finding<traccc::details::spacepoint_type::bottom>
+        mid_bot_finding(finder_config);
+    traccc::doublet_finding<traccc::details::spacepoint_type::top>
+        mid_top_finding(finder_config);
+
+    // Compare the doublets found using the two grids
+    std::size_t n_doublets = 0;
+    auto compare = [&n_doublets](const auto& aos, const auto& soa) {
+        ASSERT_EQ(aos.first.size(), soa.first.size());
+        ASSERT_EQ(aos.second.size(), soa.second.size());
+        for (std::size_t k = 0; k < aos.first.size(); ++k) {
+            EXPECT_EQ(aos.first[k].sp1, soa.first[k].sp1);
+            EXPECT_EQ(aos.first[k].sp2, soa.first[k].sp2);
+            EXPECT_EQ(aos.second[k].Zo(), soa.second[k].Zo());
+            EXPECT_EQ(aos.second[k].cotTheta(), soa.second[k].cotTheta());
+            EXPECT_EQ(aos.second[k].iDeltaR(), soa.second[k].iDeltaR());
+            EXPECT_EQ(aos.second[k].Er(), soa.second[k].Er());
+            EXPECT_EQ(aos.second[k].U(), soa.second[k].U());
+            EXPECT_EQ(aos.second[k].V(), soa.second[k].V());
+        }
+        n_doublets += aos.first.size();
+    };
+
+    for (unsigned int i = 0; i < grid.nbins(); ++i) {
+        ASSERT_EQ(grid.bin(i).size(),
+                  soa_grid.bin_end(i) - soa_grid.bin_begin(i));
+        for (unsigned int j = 0; j < grid.bin(i).size(); ++j) {
+
+            const traccc::sp_location spM{i, j};
+            ASSERT_EQ(grid.bin(i)[j].m_link,
+                      soa_grid.link[soa_grid.index(spM)]);
+
+            decltype(mid_bot_finding)::output_type mid_bot_soa;
+            mid_bot_finding(soa_grid, spM, mid_bot_soa);
+            compare(mid_bot_finding(grid, spM), mid_bot_soa);
+
+            decltype(mid_top_finding)::output_type mid_top_soa;
+            mid_top_finding(soa_grid, spM, mid_top_soa);
+            compare(mid_top_finding(grid, spM), mid_top_soa);
+        }
+    }
+    ASSERT_GT(n_doublets, 0u);
+}
+
+// Batched triplet compatibility check against the scalar one
+TEST(seeding, batched_triplet_compatibility) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+
+    const spacepoint_collection_types::host spacepoints =
+        make_straight_tracks(200u);
+    const traccc::sp_grid grid = traccc::spacepoint_binning(
+        finder_config, grid_config, host_mr)(spacepoints);
+
+    traccc::doublet_finding<traccc::details::spacepoint_type::bottom>
+        mid_bot_finding(finder_config);
+    traccc::doublet_finding<traccc::details::spacepoint_type::top>
+        mid_top_finding(finder_config);
+
+    std::size_t n_checked = 0, n_compatible = 0;
+    for (unsigned int i = 0; i < grid.nbins(); ++i) {
+        for (unsigned int j = 0; j < grid.bin(i).size(); ++j) {
+
+            const traccc::sp_location l{i, j};
+            const auto& spM = grid.bin(i)[j];
+            const auto mid_bot = mid_bot_finding(grid, l);
+            const auto mid_top = mid_top_finding(grid, l);
+            const unsigned int n_top =
+                static_cast<unsigned int>(mid_top.second.size());
+
+            for (const traccc::lin_circle& lb : mid_bot.second) {
+
+                scalar iSinTheta2 = 1 + lb.cotTheta() * lb.cotTheta();
+                scalar scatteringInRegion2 =
+                    finder_config.maxScatteringAngle2 * iSinTheta2 *
+                    finder_config.sigmaScattering *
+                    finder_config.sigmaScattering;
+
+                // Check all middle-top doublets in one batch.
+                std::unique_ptr<bool[]> compatible =
+                    std::make_unique<bool[]>(n_top);
+                std::vector<scalar> curvature(n_top), impact(n_top);
+                traccc::triplet_finding_helper::isCompatible(
+                    spM.radius(), spM.varianceR(), spM.varianceZ(), lb,
+                    mid_top.second.data(), n_top, finder_config, iSinTheta2,
+                    scatteringInRegion2, compatible.get(), curvature.data(),
+                    impact.data());
+
+                // Compare to the scalar check.
+                for (unsigned int k = 0; k < n_top; ++k) {
+                    scalar curvature_ref = 0.f, impact_ref = 0.f;
+                    const bool compatible_ref =
+                        traccc::triplet_finding_helper::isCompatible(
+                            spM, lb, mid_top.second[k], finder_config,
+                            iSinTheta2, scatteringInRegion2, curvature_ref,
+                            impact_ref);
+                    ASSERT_EQ(compatible_ref, compatible[k]);
+                    ++n_checked;
+                    if (compatible_ref) {
+                        expect_close(curvature_ref, curvature[k]);
+                        expect_close(impact_ref, impact[k]);
+                        ++n_compatible;
+                    }
+                }
+            }
+        }
+    }
+
+    // Make sure that both outcomes were tested
+    EXPECT_GT(n_compatible, 0u);
+    EXPECT_LT(n_compatible, n_checked);
+}
+
+// Triplet weighting using curvature windows, against the exhaustive search
+TEST(seeding, triplet_weights) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    const traccc::seedfilter_config filter_config;
+
+    const spacepoint_collection_types::host spacepoints =
+        make_straight_tracks(50u);
+    const traccc::sp_grid grid = traccc::spacepoint_binning(
+        finder_config, grid_config, host_mr)(spacepoints);
+
+    // All spacepoint locations of the grid
+    std::vector<traccc::sp_location> locations;
+    for (unsigned int i = 0; i < grid.nbins(); ++i) {
+        for (unsigned int j = 0; j < grid.bin(i).size(); ++j) {
+            locations.push_back({i, j});
+        }
+    }
+    ASSERT_FALSE(locations.empty());
+    auto radius = [&grid](const traccc::sp_location& l) {
+        return grid.bin(l.bin_idx)[l.sp_idx].radius();
+    };
+
+    // Random triplets, with curvatures spanning a few curvature windows
+    std::mt19937 gen(123);
+    std::uniform_int_distribution<std::size_t> loc_dist(0u,
+                                                        locations.size() - 1);
+    std::uniform_real_distribution<scalar> curv_dist(
+        -5.f * filter_config.deltaInvHelixDiameter,
+        5.f * filter_config.deltaInvHelixDiameter);
+    std::uniform_real_distribution<scalar> weight_dist(-10.f, 0.f);
+
+    traccc::triplet_finding triplet_finding(finder_config);
+    traccc::triplet_finding::scratch_type scratch;
+    for (std::size_t n_triplets : {0u, 1u, 10u, 100u, 1000u}) {
+
+        traccc::triplet_finding::output_type triplets;
+        for (std::size_t i = 0; i < n_triplets; ++i) {
+            triplets.push_back({locations[loc_dist(gen)],
+                                locations[loc_dist(gen)],
+                                locations[loc_dist(gen)], curv_dist(gen),
+                                weight_dist(gen), 0.f});
+        }
+
+        // Reference: compare every triplet to all other triplets
+        traccc::triplet_finding::output_type expected = triplets;
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            std::vector<scalar> compatibleSeedR;
+            const scalar currentTop_r = radius(expected[i].sp3);
+            for (std::size_t j = 0; j < triplets.size(); ++j) {
+                const scalar otherTop_r = radius(triplets[j].sp3);
+                if ((i == j) ||
+                    (std::abs(currentTop_r - otherTop_r) <
+                     filter_config.deltaRMin) ||
+                    (triplets[j].curvature <
+                     triplets[i].curvature -
+                         filter_config.deltaInvHelixDiameter) ||
+                    (triplets[j].curvature >
+                     triplets[i].curvature +
+                         filter_config.deltaInvHelixDiameter)) {
+                    continue;
+                }
+                if (std::none_of(compatibleSeedR.begin(),
+                                 compatibleSeedR.end(), [&](scalar r) {
+                                     return std::abs(r - otherTop_r) <
+                                            filter_config.deltaRMin;
+                                 })) {
+                    compatibleSeedR.push_back(otherTop_r);
+                    expected[i].weight += filter_config.compatSeedWeight;
+                }
+                if (compatibleSeedR.size() >= filter_config.compatSeedLimit) {
+                    break;
+                }
+            }
+        }
+
+        triplet_finding.weight_triplets(grid, triplets, scratch);
+
+        // The weights must be identical
+        ASSERT_EQ(triplets.size(), expected.size());
+        for (std::size_t i = 0; i < triplets.size(); ++i) {
+            EXPECT_EQ(triplets[i].curvature, expected[i].curvature);
+            EXPECT_EQ(triplets[i].weight, expected[i].weight);
+        }
+    }
+}
+
+// Seeding with slim spacepoints, against the one with full spacepoints
+TEST(seeding, slim_spacepoints) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100. * unit<scalar>::mm;
+    finder_config.maxPtScattering = 0.5 * unit<scalar>::GeV;
+    traccc::seeding_algorithm sa(finder_config, grid_config, filter_config,
+                                 host_mr);
+    traccc::track_params_estimation tp(host_mr);
+
+    // Give every spacepoint a unique measurement
+    spacepoint_collection_types::host spacepoints = make_straight_tracks(200u);
+    measurement_collection_types::host measurements;
+    slim_spacepoint_collection_types::host slim_spacepoints;
+    for (unsigned int i = 0; i < spacepoints.size(); ++i) {
+        spacepoint& sp = spacepoints[i];
+        sp.meas.local = {0.1f * static_cast<scalar>(i % 100u),
+                         -0.2f * static_cast<scalar>(i % 50u)};
+        sp.meas.surface_link = detray::geometry::barcode{i};
+        measurements.push_back(sp.meas);
+        slim_spacepoints.push_back({sp.global, i});
+    }
+
+    // Run the seeding and the track parameter estimation on both
+    const auto seeds = sa(spacepoints);
+    const auto slim_seeds = sa(slim_spacepoints);
+    const auto params = tp(spacepoints, seeds, B);
+    const auto slim_params = tp(slim_spacepoints, measurements, slim_seeds, B);
+
+    // The results must be identical
+    ASSERT_GT(seeds.size(), 0u);
+    ASSERT_EQ(seeds.size(), slim_seeds.size());
+    ASSERT_EQ(params.size(), slim_params.size());
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+        EXPECT_EQ(seeds[i].spB_link, slim_seeds[i].spB_link);
+        EXPECT_EQ(seeds[i].spM_link, slim_seeds[i].spM_link);
+        EXPECT_EQ(seeds[i].spT_link, slim_seeds[i].spT_link);
+        EXPECT_EQ(seeds[i].weight, slim_seeds[i].weight);
+        EXPECT_EQ(params[i].surface_link(), slim_params[i].surface_link());
+        for (unsigned int j = 0; j < e_bound_size; ++j) {
+            EXPECT_EQ(getter::element(params[i].vector(), j, 0u),
+                      getter::element(slim_params[i].vector(), j, 0u));
+        }
+    }
+}
@@ -0,0 +1,135 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/details/sparse_ccl.hpp"
+#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
+#include "traccc/edm/cell.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <random>
+#include <set>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+/// Generate randomly placed, sorted and unique cells on a few modules
+traccc::cell_collection_types::host make_cells(vecmem::memory_resource& mr,
+                                               unsigned int n_modules,
+                                               unsigned int n_cells_per_module,
+                                               unsigned int matrix_size,
+                                               unsigned int seed) {
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<traccc::channel_id> dist(0u,
+                                                           matrix_size - 1);
+
+    traccc::cell_collection_types::host cells{&mr};
+    for (unsigned int m = 0; m < n_modules; ++m) {
+        // Cells sorted by channel1, then channel0.
+        std::set<std::pair<traccc::channel_id, traccc::channel_id>> channels;
+        for (unsigned int i = 0; i < n_cells_per_module; ++i) {
+            channels.insert({dist(gen), dist(gen)});
+        }
+        for (const auto& [ch1, ch0] : channels) {
+            cells.push_back({ch0, ch1, 1.f, 0.f, m});
+        }
+    }
+    return cells;
+}
+
+/// Run one of the CCL implementations on a cell collection
+template <typename FUNC>
+std::pair<unsigned int, vecmem::vector<unsigned int>> run_ccl(
+    vecmem::memory_resource& mr,
+    const traccc::cell_collection_types::host& cells, FUNC func) {
+
+    const traccc::cell_collection_types::const_device cells_device{
+        vecmem::get_data(cells)};
+    vecmem::vector<unsigned int> labels(cells.size(), &mr);
+    vecmem::device_vector<unsigned int> labels_device{
+        vecmem::get_data(labels)};
+    const unsigned int n_clusters = func(cells_device, labels_device);
+    return {n_clusters, std::move(labels)};
+}
+
+}  // namespace
+
+class SparseCclTests
+    : public ::testing::TestWithParam<
+          std::tuple<unsigned int, unsigned int, unsigned int>> {};
+
+TEST_P(SparseCclTests, RowSweepLabels) {
+
+    vecmem::host_memory_resource mr;
+
+    const auto [n_cells, matrix_size, seed] = GetParam();
+    const traccc::cell_collection_types::host cells =
+        make_cells(mr, 3u, n_cells, matrix_size, seed);
+
+    const auto [n_pairwise, labels_pairwise] =
+        run_ccl(mr, cells, [](const auto& c, auto& l) {
+            return traccc::details::sparse_ccl(c, l);
+        });
+    const auto [n_row_sweep, labels_row_sweep] =
+        run_ccl(mr, cells, [](const auto& c, auto& l) {
+            return traccc::details::sparse_ccl_row_sweep(c, l);
+        });
+
+    ASSERT_EQ(n_pairwise, n_row_sweep);
+    ASSERT_EQ(labels_pairwise.size(), labels_row_sweep.size());
+    for (std::size_t i = 0; i < labels_pairwise.size(); ++i) {
+        EXPECT_EQ(labels_pairwise[i], labels_row_sweep[i]);
+    }
+}
+
+TEST_P(SparseCclTests, AlgorithmMethods) {
+
+    vecmem::host_memory_resource mr;
+
+    const auto [n_cells, matrix_size, seed] = GetParam();
+    const traccc::cell_collection_types::host cells =
+        make_cells(mr, 3u, n_cells, matrix_size, seed);
+
+    using algorithm = traccc::host::sparse_ccl_algorithm;
+    const auto clusters_pairwise =
+        algorithm{mr, algorithm::method::pairwise}(vecmem::get_data(cells));
+    const auto clusters_row_sweep =
+        algorithm{mr, algorithm::method::row_sweep}(vecmem::get_data(cells));
+
+    ASSERT_EQ(clusters_pairwise.size(), clusters_row_sweep.size());
+    for (std::size_t i = 0; i < clusters_pairwise.size(); ++i) {
+        const auto& items_pairwise = clusters_pairwise.get_items()[i];
+        const auto& items_row_sweep = clusters_row_sweep.get_items()[i];
+        ASSERT_EQ(items_pairwise.size(), items_row_sweep.size());
+        for (std::size_t j = 0; j < items_pairwise.size(); ++j) {
+            EXPECT_EQ(items_pairwise[j].channel0, items_row_sweep[j].channel0);
+            EXPECT_EQ(items_pairwise[j].channel1, items_row_sweep[j].channel1);
+            EXPECT_EQ(items_pairwise[j].module_link,
+                      items_row_sweep[j].module_link);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SparseCclRowSweep, SparseCclTests,
+    ::testing::Values(std::make_tuple(1u, 10u, 1u),
+                      std::make_tuple(50u, 100u, 2u),
+                      std::make_tuple(500u, 100u, 3u),
+                      std::make_tuple(2000u, 100u, 4u),
+                      std::make_tuple(5000u, 1000u, 5u),
+                      std::make_tuple(20000u, 200u, 6u)));
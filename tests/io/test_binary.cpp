@@ -6,6 +6,10 @@
  */
 
 // Project include(s).
+#include "traccc/io/archive_writer.hpp"
+#include "traccc/io/demonstrator_edm.hpp"
+#include "traccc/io/mapped_binary.hpp"
+#include "traccc/io/read.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/read_geometry.hpp"
@@ -14,6 +18,9 @@
 #include "traccc/io/utils.hpp"
 #include "traccc/io/write.hpp"
 
+// Test include(s).
+#include "tests/temp_path.hpp"
+
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
 
@@ -22,7 +29,9 @@
 
 // System
 #include <cstdio>
+#include <filesystem>
 #include <fstream>
+#include <stdexcept>
 
 // This defines the local frame test suite for binary cell container
 TEST(io_binary, cell) {
@@ -228,4 +237,163 @@ TEST(io_binary, measurement) {
     for (std::size_t i = 0; i < modules_csv.size(); i++) {
         ASSERT_EQ(modules_csv[i].surface_link, modules_binary[i].surface_link);
     }
-}
\ No newline at end of file
+}
+
+// This defines the test suite for the memory mapped binary measurements
+TEST(io_binary, mapped_measurement) {
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string measurements_directory = "tml_full/ttbar_mu300/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read csv file
+    traccc::io::measurement_reader_output reader_csv(&host_mr);
+    traccc::io::read_measurements(reader_csv, event, measurements_directory,
+                                  traccc::data_format::csv);
+    const traccc::measurement_collection_types::host& measurements_csv =
+        reader_csv.measurements;
+    const traccc::cell_module_collection_types::host& modules_csv =
+        reader_csv.modules;
+
+    // Write binary file
+    traccc::io::write(
+        event, measurements_directory, traccc::data_format::binary,
+        vecmem::get_data(measurements_csv), vecmem::get_data(modules_csv));
+
+    {
+        // Map the binary file
+        const traccc::io::mapped_measurement_reader_output mapped =
+            traccc::io::map_measurements(event, measurements_directory);
+        const traccc::measurement_collection_types::const_device
+            measurements_mapped(mapped.measurements.view());
+        const traccc::cell_module_collection_types::const_device
+            modules_mapped(mapped.modules.view());
+
+        // Check sizes
+        ASSERT_TRUE(measurements_csv.size() > 0);
+        ASSERT_EQ(measurements_csv.size(), measurements_mapped.size());
+        ASSERT_TRUE(modules_csv.size() > 0);
+        ASSERT_EQ(modules_csv.size(), modules_mapped.size());
+
+        for (std::size_t i = 0; i < measurements_csv.size(); i++) {
+            ASSERT_EQ(measurements_csv[i], measurements_mapped[i]);
+        }
+        for (std::size_t i = 0; i < modules_csv.size(); i++) {
+            ASSERT_EQ(modules_csv[i].surface_link,
+                      modules_mapped[i].surface_link);
+        }
+    }
+
+    // Truncate the measurement file, which must be detected.
+    std::string io_measurements_file =
+        traccc::io::data_directory() + measurements_directory +
+        traccc::io::get_event_filename(event, "-measurements.dat");
+    std::filesystem::resize_file(
+        io_measurements_file,
+        std::filesystem::file_size(io_measurements_file) - 1u);
+    EXPECT_THROW(traccc::io::map_measurements(event, measurements_directory),
+                 std::runtime_error);
+    traccc::io::measurement_reader_output reader_truncated(&host_mr);
+    EXPECT_THROW(traccc::io::read_measurements(reader_truncated, event,
+                                               measurements_directory,
+                                               traccc::data_format::binary),
+                 std::runtime_error);
+
+    // Delete binary files
+    std::remove(io_measurements_file.c_str());
+    ASSERT_TRUE(!std::ifstream(io_measurements_file));
+
+    std::string io_modules_file =
+        traccc::io::data_directory() + measurements_directory +
+        traccc::io::get_event_filename(event, "-modules.dat");
+    std::remove(io_modules_file.c_str());
+    ASSERT_TRUE(!std::ifstream(io_modules_file));
+}
+
+// This defines the test suite for the event archive format
+TEST(io_binary, archive) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Use a fresh directory for the archive.
+    const std::filesystem::path directory =
+        traccc::tests::unique_temp_path("traccc_io_binary_archive");
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    // Create a few events of different sizes.
+    static constexpr std::size_t n_events = 3;
+    std::vector<traccc::io::cell_reader_output> events;
+    for (std::size_t event = 0; event < n_events; ++event) {
+        traccc::io::cell_reader_output& cells = events.emplace_back(&host_mr);
+        cells.modules.resize(2);
+        cells.modules[0].surface_link = detray::geometry::barcode{}.set_index(
+            static_cast<unsigned int>(event));
+        cells.modules[1].surface_link = detray::geometry::barcode{}.set_index(
+            static_cast<unsigned int>(event + 10));
+        for (unsigned int i = 0; i < 10u * (event + 1); ++i) {
+            cells.cells.push_back({i, static_cast<traccc::channel_id>(event),
+                                   0.5f * static_cast<traccc::scalar>(i), 0.f,
+                                   i % 2u});
+        }
+    }
+
+    // Start with an unrelated archive in the directory, which must be
+    // replaced.
+    {
+        traccc::io::archive_writer archive(directory.native());
+        for (std::size_t event = 0; event < 2 * n_events; ++event) {
+            archive.write(event, vecmem::get_data(events[0].cells),
+                          vecmem::get_data(events[1].modules));
+        }
+    }
+
+    // Write the events into the archive, out of order, and more than once.
+    {
+        traccc::io::archive_writer archive(directory.native());
+        for (std::size_t event : {2u, 0u, 1u, 2u, 0u, 1u}) {
+            archive.write(event, vecmem::get_data(events[event].cells),
+                          vecmem::get_data(events[event].modules));
+        }
+        archive.close();
+        EXPECT_THROW(archive.write(0u, vecmem::get_data(events[0].cells),
+                                   vecmem::get_data(events[0].modules)),
+                     std::runtime_error);
+    }
+
+    // Read back the events one by one, and all at once.
+    traccc::demonstrator_input all_events(&host_mr);
+    for (std::size_t event = 0; event < n_events; ++event) {
+        all_events.push_back(traccc::demonstrator_input::value_type(&host_mr));
+    }
+    traccc::io::read(all_events, n_events, directory.native(), "", "",
+                     traccc::data_format::archive);
+    for (std::size_t event = 0; event < n_events; ++event) {
+        traccc::io::cell_reader_output cells(&host_mr);
+        traccc::io::read_cells(cells, event, directory.native(),
+                               traccc::data_format::archive);
+        for (const traccc::io::cell_reader_output* read :
+             {&cells, &all_events[event]}) {
+            ASSERT_EQ(read->cells.size(), events[event].cells.size());
+            for (std::size_t i = 0; i < read->cells.size(); ++i) {
+                ASSERT_EQ(read->cells[i], events[event].cells[i]);
+            }
+            ASSERT_EQ(read->modules.size(), events[event].modules.size());
+            for (std::size_t i = 0; i < read->modules.size(); ++i) {
+                ASSERT_EQ(read->modules[i], events[event].modules[i]);
+            }
+        }
+    }
+
+    // Events that were not written (only into the replaced archive) must
+    // not be found.
+    traccc::io::cell_reader_output missing(&host_mr);
+    EXPECT_THROW(traccc::io::read_cells(missing, n_events, directory.native(),
+                                        traccc::data_format::archive),
+                 std::runtime_error);
+
+    std::filesystem::remove_all(directory);
+}
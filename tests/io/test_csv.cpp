@@ -16,6 +16,7 @@
 
 // Test include(s).
 #include "tests/data_test.hpp"
+#include "tests/temp_path.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -23,6 +24,11 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
 class io : public traccc::tests::data_test {};
 
 // This defines the local frame test suite
@@ -98,6 +104,59 @@ TEST_F(io, csv_read_tml_pixelbarrel) {
     ASSERT_EQ(readOut.modules.size(), 2382u);
 }
 
+// This checks the ordering and deduplication of cells read from CSV
+TEST_F(io, csv_read_cells_deduplicate) {
+
+    // Write a small file with unordered and duplicate cells, an unknown column
+    // and Windows line endings.
+    const std::filesystem::path filename =
+        traccc::tests::unique_temp_path("traccc_test_cells", ".csv");
+    {
+        std::ofstream file(filename);
+        file << "geometry_id,hit_id,channel0,channel1,timestamp,value,extra\r\n"
+             << "20,0,3,1,0.5,0.25,x\r\n"
+             << "10,0,7,2,0,0.125,x\r\n"
+             << "20,1,1,1,0,0.5,x\r\n"
+             << "20,2,3,1,1.5,0.75,x\r\n"
+             << "10,1,2,3,0,1,x\r\n";
+    }
+
+    traccc::io::cell_reader_output cells;
+    traccc::io::read_cells(cells, filename.native(), traccc::data_format::csv);
+
+    ASSERT_EQ(cells.modules.size(), 2u);
+    EXPECT_EQ(cells.modules.at(0).surface_link.value(), 10u);
+    EXPECT_EQ(cells.modules.at(1).surface_link.value(), 20u);
+
+    // Cells are sorted by (module, channel1, channel0). Duplicates keep the
+    // first timestamp, and sum up their values.
+    ASSERT_EQ(cells.cells.size(), 4u);
+    EXPECT_EQ(cells.cells.at(0).channel0, 7u);
+    EXPECT_EQ(cells.cells.at(0).module_link, 0u);
+    EXPECT_EQ(cells.cells.at(1).channel0, 2u);
+    EXPECT_EQ(cells.cells.at(1).module_link, 0u);
+    EXPECT_EQ(cells.cells.at(2).channel0, 1u);
+    EXPECT_EQ(cells.cells.at(2).module_link, 1u);
+    EXPECT_EQ(cells.cells.at(3).channel0, 3u);
+    EXPECT_EQ(cells.cells.at(3).channel1, 1u);
+    EXPECT_EQ(cells.cells.at(3).module_link, 1u);
+    EXPECT_EQ(cells.cells.at(3).time, 0.5f);
+    EXPECT_EQ(cells.cells.at(3).activation, 1.f);
+
+    // Malformed values must be reported.
+    {
+        std::ofstream file(filename);
+        file << "geometry_id,hit_id,channel0,channel1,timestamp,value\n"
+             << "20,0,three,1,0.5,0.25\n";
+    }
+    traccc::io::cell_reader_output bad_cells;
+    EXPECT_THROW(traccc::io::read_cells(bad_cells, filename.native(),
+                                        traccc::data_format::csv),
+                 std::runtime_error);
+
+    std::filesystem::remove(filename);
+}
+
 // This checks if hit and measurement container from the first single muon event
 TEST_F(io, csv_read_tml_single_muon) {
     vecmem::host_memory_resource resource;
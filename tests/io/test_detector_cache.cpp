@@ -0,0 +1,200 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/detector_cache.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/utils.hpp"
+
+// Test include(s).
+#include "tests/temp_path.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/// The detector files used in the tests
+constexpr const char* detector_file = "tml_detector/trackml-detector.csv";
+constexpr const char* digitization_file =
+    "tml_detector/default-geometric-config-generic.json";
+
+}  // namespace
+
+// Test writing and reading back a detector cache
+TEST(io_detector_cache, round_trip) {
+
+    const std::string cache_file =
+        traccc::tests::unique_temp_path("traccc_test_detector", ".cache")
+            .native();
+
+    // The first call should create the cache.
+    const traccc::io::detector_description reference =
+        traccc::io::read_detector_description(
+            detector_file, digitization_file, traccc::data_format::csv,
+            cache_file);
+    ASSERT_TRUE(std::filesystem::exists(cache_file));
+
+    // The second call should read it back.
+    const traccc::io::detector_description cached =
+        traccc::io::read_detector_description(
+            detector_file, digitization_file, traccc::data_format::csv,
+            cache_file);
+
+    // Compare the geometries.
+    ASSERT_EQ(reference.surface_transforms.size(),
+              cached.surface_transforms.size());
+    ASSERT_EQ(reference.surface_transforms.nodes().size(),
+              cached.surface_transforms.nodes().size());
+    for (std::size_t i = 0; i < reference.surface_transforms.nodes().size();
+         ++i) {
+        const auto& ref_node = reference.surface_transforms.nodes()[i];
+        const auto& node = cached.surface_transforms.nodes()[i];
+        EXPECT_EQ(ref_node.start, node.start);
+        EXPECT_EQ(ref_node.size, node.size);
+        EXPECT_EQ(ref_node.index, node.index);
+        if (node.size > 0u) {
+            EXPECT_EQ(
+                reference.surface_transforms.at(node.start).translation(),
+                cached.surface_transforms.at(node.start).translation());
+        }
+    }
+    EXPECT_EQ(reference.barcode_map == nullptr, cached.barcode_map == nullptr);
+
+    // Compare the digitization configurations.
+    ASSERT_EQ(reference.digi_cfg.size(), cached.digi_cfg.size());
+    for (std::size_t i = 0; i < reference.digi_cfg.size(); ++i) {
+        EXPECT_EQ(reference.digi_cfg.idAt(i), cached.digi_cfg.idAt(i));
+        const auto& ref_cfg = reference.digi_cfg.valueAt(i);
+        const auto& cfg = cached.digi_cfg.valueAt(i);
+        EXPECT_EQ(ref_cfg.dimensions, cfg.dimensions);
+        EXPECT_EQ(ref_cfg.variance_y, cfg.variance_y);
+        ASSERT_EQ(ref_cfg.segmentation.dimensions(),
+                  cfg.segmentation.dimensions());
+        for (std::size_t j = 0; j < ref_cfg.segmentation.dimensions(); ++j) {
+            EXPECT_EQ(ref_cfg.segmentation.bins(j), cfg.segmentation.bins(j));
+            EXPECT_EQ(ref_cfg.segmentation.binningData()[j].min,
+                      cfg.segmentation.binningData()[j].min);
+            EXPECT_EQ(ref_cfg.segmentation.binningData()[j].max,
+                      cfg.segmentation.binningData()[j].max);
+        }
+    }
+
+    // Reading an event with both descriptions should give the same cells.
+    vecmem::host_memory_resource host_mr;
+    traccc::io::cell_reader_output ref_out(&host_mr), out(&host_mr);
+    traccc::io::read_cells(ref_out, 0, "tml_full/ttbar_mu20/",
+                           traccc::data_format::csv,
+                           &(reference.surface_transforms),
+                           &(reference.digi_cfg), nullptr);
+    traccc::io::read_cells(out, 0, "tml_full/ttbar_mu20/",
+                           traccc::data_format::csv,
+                           &(cached.surface_transforms), &(cached.digi_cfg),
+                           nullptr);
+    ASSERT_EQ(ref_out.cells.size(), out.cells.size());
+    ASSERT_EQ(ref_out.modules.size(), out.modules.size());
+    for (std::size_t i = 0; i < out.modules.size(); ++i) {
+        EXPECT_EQ(ref_out.modules[i].surface_link,
+                  out.modules[i].surface_link);
+        EXPECT_EQ(ref_out.modules[i].pixel.pitch_x,
+                  out.modules[i].pixel.pitch_x);
+        EXPECT_EQ(ref_out.modules[i].pixel.pitch_y,
+                  out.modules[i].pixel.pitch_y);
+    }
+
+    std::filesystem::remove(cache_file);
+}
+
+// Test that caches of a different version are rejected
+TEST(io_detector_cache, version_mismatch) {
+
+    const std::string cache_file =
+        traccc::tests::unique_temp_path("traccc_test_version", ".cache")
+            .native();
+
+    const traccc::io::detector_cache_sources sources{
+        detector_file, digitization_file, traccc::data_format::csv};
+    traccc::io::write_detector_cache(
+        cache_file,
+        traccc::io::read_detector_description(detector_file,
+                                              digitization_file),
+        sources);
+    EXPECT_NO_THROW(traccc::io::read_detector_cache(cache_file));
+    EXPECT_TRUE(traccc::io::detector_cache_is_valid(cache_file, sources));
+
+    // Overwrite the version, which follows the 8 byte identifier.
+    {
+        std::fstream file(cache_file,
+                          std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint32_t version = traccc::io::detector_cache_version + 1u;
+        file.seekp(8);
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    EXPECT_THROW(traccc::io::read_detector_cache(cache_file),
+                 std::runtime_error);
+    EXPECT_FALSE(traccc::io::detector_cache_is_valid(cache_file, sources));
+
+    std::filesystem::remove(cache_file);
+}
+
+// Test that caches of different source files are rebuilt
+TEST(io_detector_cache, source_mismatch) {
+
+    // Use copies of the source files, which the test can modify.
+    const std::filesystem::path directory =
+        traccc::tests::unique_temp_path("traccc_test_sources");
+    std::filesystem::create_directories(directory);
+    const std::string detector_copy = (directory / "detector.csv").native();
+    const std::string digitization_copy =
+        (directory / "digitization.json").native();
+    std::filesystem::copy_file(traccc::io::get_absolute_path(detector_file),
+                               detector_copy);
+    std::filesystem::copy_file(
+        traccc::io::get_absolute_path(digitization_file), digitization_copy);
+    const std::string cache_file = (directory / "detector.cache").native();
+
+    // Create the cache.
+    const traccc::io::detector_cache_sources sources{
+        detector_copy, digitization_copy, traccc::data_format::csv};
+    traccc::io::read_detector_description(detector_copy, digitization_copy,
+                                          traccc::data_format::csv,
+                                          cache_file);
+    EXPECT_TRUE(traccc::io::detector_cache_is_valid(cache_file, sources));
+
+    // The cache does not belong to other source files, or to another geometry
+    // format.
+    EXPECT_FALSE(traccc::io::detector_cache_is_valid(
+        cache_file, {detector_file, digitization_file,
+                     traccc::data_format::csv}));
+    EXPECT_FALSE(traccc::io::detector_cache_is_valid(
+        cache_file,
+        {detector_copy, digitization_copy, traccc::data_format::json}));
+
+    // Modify the digitization file, and check that the cache gets rebuilt.
+    {
+        std::ofstream file(digitization_copy, std::ios::app);
+        file << "\n";
+    }
+    EXPECT_FALSE(traccc::io::detector_cache_is_valid(cache_file, sources));
+    traccc::io::read_detector_description(detector_copy, digitization_copy,
+                                          traccc::data_format::csv,
+                                          cache_file);
+    EXPECT_TRUE(traccc::io::detector_cache_is_valid(cache_file, sources));
+
+    std::filesystem::remove_all(directory);
+}
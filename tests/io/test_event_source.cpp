@@ -0,0 +1,130 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/event_source.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_digitization_config.hpp"
+#include "traccc/io/read_geometry.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <set>
+#include <vector>
+
+namespace {
+
+/// Configuration of the event sources used in the tests
+traccc::io::event_source::config make_config(std::size_t reader_threads) {
+
+    traccc::io::event_source::config cfg;
+    cfg.directory = "tml_full/ttbar_mu20/";
+    cfg.detector_file = "tml_detector/trackml-detector.csv";
+    cfg.digitization_file =
+        "tml_detector/default-geometric-config-generic.json";
+    cfg.input_events = 3;
+    cfg.events = 10;
+    cfg.prefetch = 2;
+    cfg.reader_threads = reader_threads;
+    return cfg;
+}
+
+/// Read the cell counts of the input events directly
+std::vector<std::size_t> read_cell_counts(
+    const traccc::io::event_source::config& cfg, vecmem::memory_resource& mr) {
+
+    auto [geom, barcode_map] = traccc::io::read_geometry(cfg.detector_file);
+    auto digi_cfg = traccc::io::read_digitization_config(cfg.digitization_file);
+
+    std::vector<std::size_t> result;
+    for (std::size_t event = 0; event < cfg.input_events; ++event) {
+        traccc::io::cell_reader_output out(&mr);
+        traccc::io::read_cells(out, event, cfg.directory, cfg.event_format,
+                               &geom, &digi_cfg, barcode_map.get());
+        result.push_back(out.cells.size());
+    }
+    return result;
+}
+
+}  // namespace
+
+// Test that a single reader thread replays the events in order
+TEST(io_event_source, sequential) {
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto cfg = make_config(1u);
+    const std::vector<std::size_t> reference = read_cell_counts(cfg, host_mr);
+
+    traccc::io::event_source source(cfg, host_mr);
+    std::size_t n_events = 0;
+    while (auto event = source.next()) {
+        ASSERT_LT(n_events, cfg.events);
+        EXPECT_EQ(event->cells.size(),
+                  reference.at(n_events % cfg.input_events));
+        ++n_events;
+    }
+    EXPECT_EQ(n_events, cfg.events);
+    EXPECT_EQ(source.next(), nullptr);
+}
+
+// Test that multiple reader threads produce the same events
+TEST(io_event_source, parallel) {
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto cfg = make_config(3u);
+    const std::vector<std::size_t> reference = read_cell_counts(cfg, host_mr);
+    std::multiset<std::size_t> expected;
+    for (std::size_t i = 0; i < cfg.events; ++i) {
+        expected.insert(reference.at(i % cfg.input_events));
+    }
+
+    traccc::io::event_source source(cfg, host_mr);
+    source.wait_for_prefetch();
+    std::multiset<std::size_t> produced;
+    while (auto event = source.next()) {
+        produced.insert(event->cells.size());
+    }
+    EXPECT_EQ(produced, expected);
+}
+
+// Test that reading errors are forwarded to the consumer
+TEST(io_event_source, missing_input) {
+
+    vecmem::host_memory_resource host_mr;
+
+    auto cfg = make_config(2u);
+    cfg.directory = "tml_full/no_such_directory/";
+
+    traccc::io::event_source source(cfg, host_mr);
+    EXPECT_ANY_THROW(while (source.next()) {});
+}
+
+// Test that a source can be set up without reading events right away
+TEST(io_event_source, deferred_start) {
+
+    vecmem::host_memory_resource host_mr;
+
+    auto cfg = make_config(2u);
+    cfg.start_reading = false;
+
+    traccc::io::event_source source(cfg, host_mr);
+    source.start();
+    source.start();
+    std::size_t n_events = 0;
+    while (source.next()) {
+        ++n_events;
+    }
+    EXPECT_EQ(n_events, cfg.events);
+}